@@ -449,6 +449,8 @@ set (COMMON_CONFIGURE_OPTIONS
   "-DTrilinos_ENABLE_SECONDARY_TESTED_CODE:BOOL=ON"
   #
   "-DTrilinos_ENABLE_Teuchos:BOOL=ON"
+  # Atomic reference counts, so that the Workset Threads tests run
+  "-DTrilinos_ENABLE_THREAD_SAFE:BOOL=ON"
   "-DTrilinos_ENABLE_Shards:BOOL=ON"
   "-DTrilinos_ENABLE_Sacado:BOOL=ON"
   "-DTrilinos_ENABLE_Epetra:BOOL=ON"
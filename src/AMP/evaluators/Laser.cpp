@@ -10,7 +10,8 @@
 namespace AMP
 {
   //constructor
-  Laser::Laser()
+  Laser::Laser() :
+    haveLast_(false)
   {
     std::ifstream is("LaserCenter.txt", std::ifstream::in);
     TEUCHOS_TEST_FOR_EXCEPTION(!is, Teuchos::Exceptions::InvalidParameter,
@@ -38,7 +39,9 @@ namespace AMP
 
   }
   // copy constructor
-  Laser::Laser(const Laser &A)
+  Laser::Laser(const Laser &A) :
+    haveLast_(A.haveLast_),
+    last_(A.last_)
   {
     LaserData_ = A.LaserData_;
   }
@@ -58,6 +61,15 @@ namespace AMP
   // interpolate
   void Laser::getLaserPosition(RealType t, LaserCenter val, RealType &x, RealType &y, int &power, RealType &power_fraction)
   {
+    if ( haveLast_ && last_.t == t )
+      {
+	x = last_.x;
+	y = last_.y;
+	power = last_.power;
+	power_fraction = last_.power_fraction;
+	return;
+      }
+
     Teuchos::Array<LaserCenter>::iterator low;
     // this line below works because Teuchos::Array<T> is a lighweight implementation of
     // std::vector<T>
@@ -118,6 +130,13 @@ namespace AMP
       {
 	power = 0; // off
       }
+
+    last_.t = t;
+    last_.x = x;
+    last_.y = y;
+    last_.power = power;
+    last_.power_fraction = power_fraction;
+    haveLast_ = true;
   }
 
   // function used in some STL (standard template library) containers
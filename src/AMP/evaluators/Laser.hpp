@@ -17,6 +17,10 @@
 #include "Teuchos_Array.hpp"
 #include "Albany_Layouts.hpp"
 
+#include <algorithm>
+#include <limits>
+#include <vector>
+
 
 
 namespace AMP
@@ -42,10 +46,78 @@ namespace AMP
     ~Laser();
     // get LaserData_
     const Teuchos::Array<LaserCenter> &getLaserData();
-    // interpolate
+    // interpolate; the last result is kept, so every workset of a time step
+    // after the first one gets it without searching the track again
     void getLaserPosition(RealType time, LaserCenter val, RealType &x, RealType &y, int &power, RealType &power_fraction);
   private:
     Teuchos::Array<LaserCenter> LaserData_;
+    // last interpolated laser center
+    bool haveLast_;
+    LaserCenter last_;
+  };
+
+  // axis-aligned bounding box of the quadrature points of a workset
+  struct WorksetBox
+  {
+    RealType min[3];
+    RealType max[3];
+
+    // true if no point of the box lies within radius of (x,y) in the x-y plane
+    bool outsideFootprint(RealType x, RealType y, RealType radius) const
+    {
+      const RealType dx = std::max(std::max(min[0] - x, x - max[0]), RealType(0.0));
+      const RealType dy = std::max(std::max(min[1] - y, y - max[1]), RealType(0.0));
+      return dx*dx + dy*dy >= radius*radius;
+    }
+  };
+
+  // bounding boxes of the worksets seen by an evaluator, kept until the mesh
+  // version of the discretization changes. Discretizations without a mesh
+  // version (or worksets without one) get the box recomputed on every call.
+  class WorksetBoxes
+  {
+  public:
+    WorksetBoxes() : meshVersion_(-1) {}
+
+    template<typename MeshScalarT, typename CoordT>
+    const WorksetBox &get(const int ws, const int meshVersion, const CoordT &coord,
+                          const int numCells, const int numQPs)
+    {
+      if (meshVersion != meshVersion_)
+        {
+          boxes_.clear();
+          filled_.clear();
+          meshVersion_ = meshVersion;
+        }
+      if (ws >= static_cast<int>(boxes_.size()))
+        {
+          boxes_.resize(ws+1);
+          filled_.resize(ws+1, false);
+        }
+      WorksetBox &box = boxes_[ws];
+      if (filled_[ws] && meshVersion >= 0) return box;
+
+      for (int i = 0; i < 3; ++i)
+        {
+          box.min[i] = std::numeric_limits<RealType>::max();
+          box.max[i] = -std::numeric_limits<RealType>::max();
+        }
+      for (int cell = 0; cell < numCells; ++cell)
+        for (int qp = 0; qp < numQPs; ++qp)
+          for (int i = 0; i < 3; ++i)
+            {
+              const RealType X = Sacado::ScalarValue<MeshScalarT>::eval(coord(cell,qp,i));
+              box.min[i] = std::min(box.min[i], X);
+              box.max[i] = std::max(box.max[i], X);
+            }
+      filled_[ws] = true;
+      return box;
+    }
+
+  private:
+    int meshVersion_;
+    std::vector<WorksetBox> boxes_;
+    std::vector<bool> filled_;
   };
   
   bool compLaserCenter(LaserCenter A, LaserCenter B);
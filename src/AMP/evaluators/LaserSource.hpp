@@ -72,6 +72,7 @@ private:
   unsigned int workset_size_;
 
   Laser LaserData_;
+  WorksetBoxes boxes_;
 
   Teuchos::RCP<const Teuchos::ParameterList>
      getValidLaserSourceParameters() const;
@@ -168,6 +168,18 @@ evaluateFields(typename Traits::EvalData workset)
   ScalarT f2 = 2*powder_hemispherical_reflectivity*a*a/C;
   ScalarT f3 = 3.0*(1.0 - powder_hemispherical_reflectivity);
 
+//  Worksets lying entirely outside the beam footprint or below the powder bed
+//  get no heat, and neither does any workset while the laser is off
+  const int meshVersion = workset.disc.is_null() ? -1 : workset.disc->getMeshVersion();
+  const WorksetBox& box = boxes_.template get<MeshScalarT>(workset.wsIndex, meshVersion,
+                                                           coord_, workset.numCells, num_qps_);
+  if ( power != 1 ||
+       box.outsideFootprint(x, y, Albany::ADValue(laser_beam_radius)) ||
+       beta*box.min[2] > lambda ) {
+    laser_source_.deep_copy(ScalarT(0.0));
+    return;
+  }
+
 //-----------------------------------------------------------------------------------------------
   for (std::size_t cell = 0; cell < workset.numCells; ++cell) {
     for (std::size_t qp = 0; qp < num_qps_; ++qp) {
@@ -175,11 +187,11 @@ evaluateFields(typename Traits::EvalData workset)
 	  MeshScalarT Y = coord_(cell,qp,1);
 	  MeshScalarT Z = coord_(cell,qp,2);
 
-    ScalarT depth_profile = f1*(f2*(A*(b2*exp(2.0*a*beta*Z)-b1*exp(-2.0*a*beta*Z)) - B*(c2*exp(-2.0*a*(lambda - beta*Z))-c1*exp(2.0*a*(lambda-beta*Z)))) + f3*(exp(-beta*Z)+powder_hemispherical_reflectivity*exp(beta*Z - 2.0*lambda)));
-    MeshScalarT* XX = &coord_(cell,qp,0);
     ScalarT radius = sqrt((X - Laser_center_x)*(X - Laser_center_x) + (Y - Laser_center_y)*(Y - Laser_center_y));
-     if (radius < laser_beam_radius && beta*Z <= lambda)
+     if (radius < laser_beam_radius && beta*Z <= lambda) {
+            ScalarT depth_profile = f1*(f2*(A*(b2*exp(2.0*a*beta*Z)-b1*exp(-2.0*a*beta*Z)) - B*(c2*exp(-2.0*a*(lambda - beta*Z))-c1*exp(2.0*a*(lambda-beta*Z)))) + f3*(exp(-beta*Z)+powder_hemispherical_reflectivity*exp(beta*Z - 2.0*lambda)));
             laser_source_(cell,qp) = beta*LaserFlux_Max*pow((1.0-(radius*radius)/(laser_beam_radius*laser_beam_radius)),2)*depth_profile;
+     }
      else   laser_source_(cell,qp) = 0.0;
 	
     }
@@ -64,6 +64,7 @@ private:
   unsigned int workset_size_;
 
   Laser LaserData_;
+  WorksetBoxes boxes_;
 
 
   Teuchos::RCP<const Teuchos::ParameterList>
@@ -174,6 +174,21 @@ evaluateFields(typename Traits::EvalData workset)
   
   //std::cout<<" ebname ="<<workset.EBName<<std::endl; 
   //std::cout<<"current time ="<<workset.current_time<<std::endl;
+  // Worksets lying entirely outside the beam footprint or above the substrate
+  // get no heat, and neither does any workset while the laser is off
+  const int meshVersion = workset.disc.is_null() ? -1 : workset.disc->getMeshVersion();
+  const WorksetBox& box = boxes_.template get<MeshScalarT>(workset.wsIndex, meshVersion,
+                                                           coord_, workset.numCells, num_qps_);
+  if ( power != 1 ||
+       box.outsideFootprint(x, y, Albany::ADValue(laser_beam_radius)) ||
+       box.max[2] < Albany::ADValue(Substrate_Top) ) {
+    source_.deep_copy(ScalarT(0.0));
+    return;
+  }
+
+  //Value of depth profile at z = lambda
+  ScalarT depth_profile_lambda = f1*(f2*(A*(b2*exp(2.0*a*lambda)-b1*exp(-2.0*a*lambda)) - B*(c2*exp(-2.0*a*(lambda - lambda))-c1*exp(2.0*a*(lambda-lambda)))) + f3*(exp(-lambda)+powder_hemispherical_reflectivity*exp(lambda - 2.0*lambda)));
+
   // source function
   for (std::size_t cell = 0; cell < workset.numCells; ++cell) {
     for (std::size_t qp = 0; qp < num_qps_; ++qp) {
@@ -181,9 +196,6 @@ evaluateFields(typename Traits::EvalData workset)
         MeshScalarT Y = coord_(cell,qp,1);
         MeshScalarT Z = coord_(cell,qp,2);
 		
-		//Value of depth profile at z = lambda
-		ScalarT depth_profile_lambda = f1*(f2*(A*(b2*exp(2.0*a*lambda)-b1*exp(-2.0*a*lambda)) - B*(c2*exp(-2.0*a*(lambda - lambda))-c1*exp(2.0*a*(lambda-lambda)))) + f3*(exp(-lambda)+powder_hemispherical_reflectivity*exp(lambda - 2.0*lambda)));
-  
                            
         ScalarT radius = sqrt((X - Laser_center_x)*(X - Laser_center_x) + (Y - Laser_center_y)*(Y - Laser_center_y));
         /*
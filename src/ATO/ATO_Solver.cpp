@@ -6,6 +6,7 @@
 
 #include "ATO_Solver.hpp"
 #include "ATO_OptimizationProblem.hpp"
+#include "ATO_PointGrid.hpp"
 #include "ATO_TopoTools.hpp"
 #include "ATO_Types.hpp"
 
@@ -1845,94 +1846,99 @@ ATO::SpatialFilter::buildOperator(
   
     std::map< GlobalPoint, std::set<GlobalPoint> > neighbors;
   
-    double filter_radius_sqrd = filterRadius*filterRadius;
-    // awful n^2 search... all against all
+    // collect the unique nodes of the worksets.  nodes in the filtered blocks
+    // that are not excluded can be neighbors and are binned in a grid.
     size_t dimension   = app->getDiscretization()->getNumDim();
-    GlobalPoint homeNode;
     size_t num_worksets = coords.size();
-    for (size_t home_ws=0; home_ws<num_worksets; home_ws++) {
-      int home_num_cells = coords[home_ws].size();
-      for (int home_cell=0; home_cell<home_num_cells; home_cell++) {
-        size_t num_nodes = coords[home_ws][home_cell].size();
-        for (int home_node=0; home_node<num_nodes; home_node++) {
-          homeNode.gid = wsElNodeID[home_ws][home_cell][home_node];
-          if(neighbors.find(homeNode)==neighbors.end()) {  // if this node was already accessed just skip
-            for (int dim=0; dim<dimension; dim++)  {
-              homeNode.coords[dim] = coords[home_ws][home_cell][home_node][dim];
-            }
-            std::set<GlobalPoint> my_neighbors;
-            if( excludeNodes.find(homeNode.gid) == excludeNodes.end() ){
-              for (size_t trial_ws=0; trial_ws<num_worksets; trial_ws++) {
-                if( blocks.size() > 0 && 
-                    find(blocks.begin(), blocks.end(), wsEBNames[trial_ws]) == blocks.end() ) continue;
-                int trial_num_cells = coords[trial_ws].size();
-                for (int trial_cell=0; trial_cell<trial_num_cells; trial_cell++) {
-                  size_t trial_num_nodes = coords[trial_ws][trial_cell].size();
-                  for (int trial_node=0; trial_node<trial_num_nodes; trial_node++) {
-                    int gid = wsElNodeID[trial_ws][trial_cell][trial_node];
-                    if( excludeNodes.find(gid) != excludeNodes.end() ) continue; // don't add excluded nodes
-                    double tmp;
-                    double delta_norm_sqr = 0.;
-                    for (int dim=0; dim<dimension; dim++)  { //individual coordinates
-                      tmp = homeNode.coords[dim]-coords[trial_ws][trial_cell][trial_node][dim];
-                      delta_norm_sqr += tmp*tmp;
-                    }
-                    if(delta_norm_sqr<=filter_radius_sqrd) {
-                      GlobalPoint newIntx;
-                      newIntx.gid = wsElNodeID[trial_ws][trial_cell][trial_node];
-                      for (int dim=0; dim<dimension; dim++) 
-                        newIntx.coords[dim] = coords[trial_ws][trial_cell][trial_node][dim];
-                      my_neighbors.insert(newIntx);
-                    }
-                  }
-                }
-              }
-            }
-            neighbors.insert( std::pair<GlobalPoint,std::set<GlobalPoint> >(homeNode,my_neighbors) );
+    std::vector<GlobalPoint> nodes;
+    std::vector<bool> isTrialNode;
+    std::unordered_map<GO,int> nodeIndex;
+    for (size_t ws=0; ws<num_worksets; ws++) {
+      bool trial_ws = ( blocks.size() == 0 ||
+                        find(blocks.begin(), blocks.end(), wsEBNames[ws]) != blocks.end() );
+      int num_cells = coords[ws].size();
+      for (int cell=0; cell<num_cells; cell++) {
+        size_t num_nodes = coords[ws][cell].size();
+        for (int node=0; node<num_nodes; node++) {
+          GO gid = wsElNodeID[ws][cell][node];
+          auto inserted = nodeIndex.insert(std::make_pair(gid,(int)nodes.size()));
+          if( inserted.second ){
+            GlobalPoint newNode;
+            newNode.gid = gid;
+            for (int dim=0; dim<dimension; dim++)
+              newNode.coords[dim] = coords[ws][cell][node][dim];
+            nodes.push_back(newNode);
+            isTrialNode.push_back(false);
           }
+          if( trial_ws && excludeNodes.find(gid) == excludeNodes.end() )
+            isTrialNode[inserted.first->second] = true;
         }
       }
     }
 
+    ATO::PointGrid trialNodes(filterRadius, dimension);
+    int num_nodes = nodes.size();
+    for (int inode=0; inode<num_nodes; inode++)
+      if( isTrialNode[inode] ) trialNodes.add(inode, nodes[inode].coords);
+
+    // radius search about each node that is smoothed
+    for (int inode=0; inode<num_nodes; inode++) {
+      const GlobalPoint& homeNode = nodes[inode];
+      std::set<GlobalPoint> my_neighbors;
+      if( excludeNodes.find(homeNode.gid) == excludeNodes.end() ){
+        trialNodes.forEachWithin(homeNode.coords,
+          [&](int trial){ my_neighbors.insert(nodes[trial]); });
+      }
+      neighbors.insert( std::pair<GlobalPoint,std::set<GlobalPoint> >(homeNode,my_neighbors) );
+    }
+
     // communicate neighbor data
     importNeighbors(neighbors,importerT,*localNodeMapT,exporterT,*overlapNodeMapT);
     
     // for each interior node, search boundary nodes for additional interactions off processor.
     
-    // now build filter operator
-    int numnonzeros = 0;
-    Teuchos::RCP<Epetra_Comm> comm = 
-      Albany::createEpetraCommFromTeuchosComm(localNodeMapT->getComm());
-    Teuchos::RCP<Epetra_Map> localNodeMap = Petra::TpetraMap_To_EpetraMap(localNodeMapT, comm); 
-    filterOperatorT = Teuchos::rcp(new Tpetra_CrsMatrix(localNodeMapT,numnonzeros));
+    // now build filter operator.  rows are assembled in bulk and only for
+    // owned nodes; rows of ghosted nodes are completed by their owners.
+    size_t numLocalRows = localNodeMapT->getNodeNumElements();
+    Teuchos::Array<Teuchos::Array<GO> > rowCols(numLocalRows);
+    Teuchos::Array<Teuchos::Array<ST> > rowWeights(numLocalRows);
     for (std::map<GlobalPoint,std::set<GlobalPoint> >::iterator 
         it=neighbors.begin(); it!=neighbors.end(); ++it) { 
-      GlobalPoint homeNode = it->first;
-      GO home_node_gid = homeNode.gid;
-      std::set<GlobalPoint> connected_nodes = it->second;
-      ST weight; 
-      ST zero = 0.0;  
-      Teuchos::Array<ST> weightT(1);
+      const GlobalPoint& homeNode = it->first;
+      LO home_node_lid = localNodeMapT->getLocalElement(homeNode.gid);
+      if( home_node_lid == Teuchos::OrdinalTraits<LO>::invalid() ) continue;
+      const std::set<GlobalPoint>& connected_nodes = it->second;
+      Teuchos::Array<GO>& cols = rowCols[home_node_lid];
+      Teuchos::Array<ST>& weights = rowWeights[home_node_lid];
       if( connected_nodes.size() > 0 ){
-        for (std::set<GlobalPoint>::iterator 
+        cols.reserve(connected_nodes.size());
+        weights.reserve(connected_nodes.size());
+        for (std::set<GlobalPoint>::const_iterator 
              set_it=connected_nodes.begin(); set_it!=connected_nodes.end(); ++set_it) {
-           GO neighbor_node_gid = set_it->gid;
            const double* coords = &(set_it->coords[0]);
            double distance = 0.0;
            for (int dim=0; dim<dimension; dim++) 
              distance += (coords[dim]-homeNode.coords[dim])*(coords[dim]-homeNode.coords[dim]);
            distance = (distance > 0.0) ? sqrt(distance) : 0.0;
-           weight = filterRadius - distance;
-           filterOperatorT->insertGlobalValues(home_node_gid,1,&zero,&neighbor_node_gid); 
-           filterOperatorT->replaceGlobalValues(home_node_gid,1,&weight,&neighbor_node_gid); 
+           cols.push_back(set_it->gid);
+           weights.push_back(filterRadius - distance);
         }
       } else {
          // if the list of connected nodes is empty, still add a one on the diagonal.
-         weight = 1.0;
-         filterOperatorT->insertGlobalValues(home_node_gid,1,&zero,&home_node_gid); 
-         filterOperatorT->replaceGlobalValues(home_node_gid,1,&weight,&home_node_gid); 
+         cols.push_back(homeNode.gid);
+         weights.push_back(1.0);
       }
     }
+
+    Teuchos::ArrayRCP<size_t> numEntriesPerRow(numLocalRows);
+    for (size_t row=0; row<numLocalRows; row++)
+      numEntriesPerRow[row] = rowCols[row].size();
+    filterOperatorT = Teuchos::rcp(new Tpetra_CrsMatrix(localNodeMapT,numEntriesPerRow,Tpetra::StaticProfile));
+    for (size_t row=0; row<numLocalRows; row++) {
+      if( rowCols[row].size() == 0 ) continue;
+      filterOperatorT->insertGlobalValues(localNodeMapT->getGlobalElement(row),
+                                          rowCols[row](), rowWeights[row]());
+    }
   
     filterOperatorT->fillComplete();
 
@@ -2016,12 +2022,16 @@ ATO::SpatialFilter::importNeighbors(
   while(newPoints > 0){
     newPoints = 0;
 
+    // new neighbors can't be immediately added to the neighbor map or they'll be
+    // found and added to the list that's communicated to other procs.
+    std::map< ATO::GlobalPoint, std::set<ATO::GlobalPoint> > newNeighbors;
+
+    // the neighborhoods of the boundary nodes shared with a processor are sent
+    // in one message.  for each boundary node, in gid order, a header point
+    // carrying the number of neighbors in its gid is followed by the neighbors.
     int numNeighborProcs = boundaryNodesByProc.size();
-    std::vector<std::vector<int> > numNeighbors_send(numNeighborProcs);
-    std::vector<std::vector<int> > numNeighbors_recv(numNeighborProcs);
-    
- 
-    // determine number of neighborhood nodes to be communicated
+    std::vector<std::vector<ATO::GlobalPoint> > sendBuffers(numNeighborProcs);
+    std::vector<MPI_Request> sendRequests(numNeighborProcs);
     int index = 0;
     std::map<int, std::set<int> >::iterator boundaryNodesIter;
     for( boundaryNodesIter=boundaryNodesByProc.begin(); 
@@ -2029,17 +2039,11 @@ ATO::SpatialFilter::importNeighbors(
          boundaryNodesIter++){
    
       int send_to = boundaryNodesIter->first;
-      int recv_from = send_to;
-  
       std::set<int>& boundaryNodes = boundaryNodesIter->second; 
-      int numNodes = boundaryNodes.size();
-  
-      numNeighbors_send[index].resize(numNodes);
-      numNeighbors_recv[index].resize(numNodes);
+      std::vector<ATO::GlobalPoint>& sendBuffer = sendBuffers[index];
   
       ATO::GlobalPoint sendPoint;
       std::map< ATO::GlobalPoint, std::set<ATO::GlobalPoint> >::iterator sendPointIter;
-      int localIndex = 0;
       std::set<int>::iterator boundaryNodeGID;
       for(boundaryNodeGID=boundaryNodes.begin(); 
           boundaryNodeGID!=boundaryNodes.end();
@@ -2048,135 +2052,79 @@ ATO::SpatialFilter::importNeighbors(
         sendPointIter = neighbors.find(sendPoint);
         TEUCHOS_TEST_FOR_EXCEPT( sendPointIter == neighbors.end() );
         std::set<ATO::GlobalPoint>& sendPointSet = sendPointIter->second;
-        numNeighbors_send[index][localIndex] = sendPointSet.size();
-        localIndex++;
+        ATO::GlobalPoint header;
+        header.gid = sendPointSet.size();
+        sendBuffer.push_back(header);
+        sendBuffer.insert(sendBuffer.end(), sendPointSet.begin(), sendPointSet.end());
       }
   
-      MPI_Status status;
-      MPI_Sendrecv(&(numNeighbors_send[index][0]), numNodes, MPI_INT, send_to, 0,
-                   &(numNeighbors_recv[index][0]), numNodes, MPI_INT, recv_from, 0,
-                   MPI_COMM_WORLD, &status);
+      MPI_Isend(sendBuffer.data(), sendBuffer.size(), MPI_GlobalPoint, send_to, 0,
+                MPI_COMM_WORLD, &sendRequests[index]);
       index++;
     }
   
-    // new neighbors can't be immediately added to the neighbor map or they'll be
-    // found and added to the list that's communicated to other procs.  This causes
-    // problems because the message length has already been communicated.  
-    std::map< ATO::GlobalPoint, std::set<ATO::GlobalPoint> > newNeighbors;
-  
-    // communicate neighborhood nodes
-    index = 0;
+    std::vector<ATO::GlobalPoint> recvBuffer;
     for( boundaryNodesIter=boundaryNodesByProc.begin(); 
          boundaryNodesIter!=boundaryNodesByProc.end(); 
          boundaryNodesIter++){
    
-      // determine total message size
-      int totalNumEntries_send = 0;
-      int totalNumEntries_recv = 0;
-      std::vector<int>& send = numNeighbors_send[index];
-      std::vector<int>& recv = numNeighbors_recv[index];
-      int totalNumNodes = send.size();
-      for(int i=0; i<totalNumNodes; i++){
-        totalNumEntries_send += send[i];
-        totalNumEntries_recv += recv[i];
-      }
+      int recv_from = boundaryNodesIter->first;
   
-      int send_to = boundaryNodesIter->first;
-      int recv_from = send_to;
+      // message size is not known in advance
+      MPI_Status status;
+      int totalNumEntries_recv = 0;
+      MPI_Probe(recv_from, 0, MPI_COMM_WORLD, &status);
+      MPI_Get_count(&status, MPI_GlobalPoint, &totalNumEntries_recv);
+      recvBuffer.resize(totalNumEntries_recv);
+      MPI_Recv(recvBuffer.data(), totalNumEntries_recv, MPI_GlobalPoint, recv_from, 0,
+               MPI_COMM_WORLD, &status);
   
-      ATO::GlobalPoint* GlobalPoints_send = new ATO::GlobalPoint[totalNumEntries_send];
-      ATO::GlobalPoint* GlobalPoints_recv = new ATO::GlobalPoint[totalNumEntries_recv];
-      
-      // copy into contiguous memory
+      // unpack
       std::set<int>& boundaryNodes = boundaryNodesIter->second;
-      ATO::GlobalPoint sendPoint;
-      std::map< ATO::GlobalPoint, std::set<ATO::GlobalPoint> >::iterator sendPointIter;
+      ATO::GlobalPoint recvPoint;
       std::set<int>::iterator boundaryNodeGID;
-      int numNodes = boundaryNodes.size();
       int offset = 0;
       for(boundaryNodeGID=boundaryNodes.begin(); 
           boundaryNodeGID!=boundaryNodes.end();
           boundaryNodeGID++){
-        // get neighbors for boundary node i
-        sendPoint.gid = *boundaryNodeGID;
-        sendPointIter = neighbors.find(sendPoint);
-        TEUCHOS_TEST_FOR_EXCEPT( sendPointIter == neighbors.end() );
-        std::set<ATO::GlobalPoint>& sendPointSet = sendPointIter->second;
-        // copy neighbors into contiguous memory
-        for(std::set<ATO::GlobalPoint>::iterator igp=sendPointSet.begin(); 
-            igp!=sendPointSet.end(); igp++){
-          GlobalPoints_send[offset] = *igp;
-          offset++;
-        }
+        recvPoint.gid = *boundaryNodeGID;
+        int nrecv = recvBuffer[offset].gid;
+        offset++;
+        std::set<ATO::GlobalPoint>& newPointSet = newNeighbors[recvPoint];
+        newPointSet.insert(recvBuffer.begin()+offset, recvBuffer.begin()+offset+nrecv);
+        offset += nrecv;
       }
+    }
   
-      MPI_Status status;
-      MPI_Sendrecv(GlobalPoints_send, totalNumEntries_send, MPI_GlobalPoint, send_to, 0,
-                   GlobalPoints_recv, totalNumEntries_recv, MPI_GlobalPoint, recv_from, 0,
-                   MPI_COMM_WORLD, &status);
+    MPI_Waitall(numNeighborProcs, sendRequests.data(), MPI_STATUSES_IGNORE);
   
-      // copy out of contiguous memory
-      ATO::GlobalPoint recvPoint;
-      std::map< ATO::GlobalPoint, std::set<ATO::GlobalPoint> >::iterator recvPointIter;
-      offset = 0;
-      int localIndex=0;
-      for(boundaryNodeGID=boundaryNodes.begin(); 
-          boundaryNodeGID!=boundaryNodes.end();
-          boundaryNodeGID++){
-        recvPoint.gid = *boundaryNodeGID;
-        recvPointIter = newNeighbors.find(recvPoint);
-        if( recvPointIter == newNeighbors.end() ){ // not found, add.
-          std::set<ATO::GlobalPoint> newPointSet;
-          int nrecv = recv[localIndex];
-          for(int j=0; j<nrecv; j++){
-            newPointSet.insert(GlobalPoints_recv[offset]);
-            offset++;
-          }
-          newNeighbors.insert( std::pair<ATO::GlobalPoint,std::set<ATO::GlobalPoint> >(recvPoint,newPointSet) );
-        } else {
-          int nrecv = recv[localIndex];
-          for(int j=0; j<nrecv; j++){
-            recvPointIter->second.insert(GlobalPoints_recv[offset]);
-            offset++;
-          }
-        }
-        localIndex++;
+    // add newNeighbors map to neighbors map.  the received points are binned
+    // so each node only checks those near it.
+    std::vector<ATO::GlobalPoint> remotePoints;
+    ATO::PointGrid remoteGrid(filterRadius, 3);
+    std::map< ATO::GlobalPoint, std::set<ATO::GlobalPoint> >::iterator nbrs;
+    std::set< ATO::GlobalPoint >::iterator remote_point;
+    for(nbrs=newNeighbors.begin(); nbrs!=newNeighbors.end(); nbrs++){
+      std::set<ATO::GlobalPoint>& remote_points = nbrs->second;
+      for(remote_point=remote_points.begin(); 
+          remote_point!=remote_points.end();
+          remote_point++){
+        remoteGrid.add(remotePoints.size(), remote_point->coords);
+        remotePoints.push_back(*remote_point);
       }
-   
-      delete [] GlobalPoints_send;
-      delete [] GlobalPoints_recv;
-      
-      index++;
     }
-  
-    // add newNeighbors map to neighbors map
-    std::map< ATO::GlobalPoint, std::set<ATO::GlobalPoint> >::iterator new_nbr;
-    std::map< ATO::GlobalPoint, std::set<ATO::GlobalPoint> >::iterator nbr;
-    std::set< ATO::GlobalPoint >::iterator newPoint;
+
     // loop on total neighbor list
+    std::map< ATO::GlobalPoint, std::set<ATO::GlobalPoint> >::iterator nbr;
     for(nbr=neighbors.begin(); nbr!=neighbors.end(); nbr++){
   
       std::set<ATO::GlobalPoint>& pointSet = nbr->second;
       int pointSetSize = pointSet.size();
   
-      ATO::GlobalPoint home_point = nbr->first;
-      double* home_coords = &(home_point.coords[0]);
-      std::map< ATO::GlobalPoint, std::set<ATO::GlobalPoint> >::iterator nbrs;
-      std::set< ATO::GlobalPoint >::iterator remote_point;
-      for(nbrs=newNeighbors.begin(); nbrs!=newNeighbors.end(); nbrs++){
-        std::set<ATO::GlobalPoint>& remote_points = nbrs->second;
-        for(remote_point=remote_points.begin(); 
-            remote_point!=remote_points.end();
-            remote_point++){
-          const double* remote_coords = &(remote_point->coords[0]);
-          double distance = 0.0;
-          for(int i=0; i<3; i++)
-            distance += (remote_coords[i]-home_coords[i])*(remote_coords[i]-home_coords[i]);
-          distance = (distance > 0.0) ? sqrt(distance) : 0.0;
-          if( distance < filterRadius )
-            pointSet.insert(*remote_point);
-        }
-      }
+      const ATO::GlobalPoint& home_point = nbr->first;
+      remoteGrid.forEachWithin(home_point.coords,
+        [&](int remote){ pointSet.insert(remotePoints[remote]); }, /*strict=*/true);
+
       // see if any new points where found off processor.  
       newPoints += (pointSet.size() - pointSetSize);
     }
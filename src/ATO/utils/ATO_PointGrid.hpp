@@ -0,0 +1,107 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ATO_PointGrid_HPP
+#define ATO_PointGrid_HPP
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace ATO {
+
+/** \brief Uniform grid hash for fixed-radius neighbor searches
+
+    Points are binned into cubic cells with edge length equal to the search
+    radius, so all points within the radius of a query point lie in the 3^dim
+    cells around it.  Building is O(n) and each query visits only nearby
+    points.
+
+*/
+class PointGrid
+{
+public:
+  PointGrid(double radius, int dimension) :
+    cellSize( radius > 0.0 ? radius : 1.0 ),
+    radiusSqrd( radius*radius ),
+    numDim( dimension ) {}
+
+  //! add a point. 'index' is returned by queries.
+  void add(int index, const double* x)
+  {
+    std::array<double,3> p = {{0.0, 0.0, 0.0}};
+    for(int dim=0; dim<numDim; dim++) p[dim] = x[dim];
+    cells[key(cellIndex(p))].push_back(points.size());
+    points.push_back(p);
+    indices.push_back(index);
+  }
+
+  //! call f(index) for every point with |x - point|^2 <= radius^2.
+  //! if 'strict' is set, points at exactly the radius are skipped.
+  template<typename F>
+  void forEachWithin(const double* x, F f, bool strict=false) const
+  {
+    std::array<double,3> p = {{0.0, 0.0, 0.0}};
+    for(int dim=0; dim<numDim; dim++) p[dim] = x[dim];
+    std::array<long,3> c = cellIndex(p);
+
+    int lo[3] = {0,0,0}, hi[3] = {0,0,0};
+    for(int dim=0; dim<numDim; dim++){ lo[dim] = -1; hi[dim] = 1; }
+
+    for(int i=lo[0]; i<=hi[0]; i++)
+      for(int j=lo[1]; j<=hi[1]; j++)
+        for(int k=lo[2]; k<=hi[2]; k++){
+          std::array<long,3> n = {{c[0]+i, c[1]+j, c[2]+k}};
+          auto cell = cells.find(key(n));
+          if( cell == cells.end() ) continue;
+          for(int ip : cell->second){
+            const std::array<double,3>& q = points[ip];
+            double delta_norm_sqr = 0.0;
+            for(int dim=0; dim<numDim; dim++){
+              double tmp = p[dim]-q[dim];
+              delta_norm_sqr += tmp*tmp;
+            }
+            bool inside = strict ? delta_norm_sqr <  radiusSqrd
+                                 : delta_norm_sqr <= radiusSqrd;
+            if( inside ) f(indices[ip]);
+          }
+        }
+  }
+
+  size_t size() const { return points.size(); }
+
+private:
+  std::array<long,3> cellIndex(const std::array<double,3>& p) const
+  {
+    std::array<long,3> c = {{0, 0, 0}};
+    for(int dim=0; dim<numDim; dim++)
+      c[dim] = static_cast<long>(std::floor(p[dim]/cellSize));
+    return c;
+  }
+
+  static std::uint64_t key(const std::array<long,3>& c)
+  {
+    // 21 bits per direction
+    const std::uint64_t mask = (std::uint64_t(1) << 21) - 1;
+    return ((std::uint64_t(c[0]) & mask) << 42) |
+           ((std::uint64_t(c[1]) & mask) << 21) |
+            (std::uint64_t(c[2]) & mask);
+  }
+
+  double cellSize;
+  double radiusSqrd;
+  int numDim;
+
+  std::vector<std::array<double,3> > points;
+  std::vector<int> indices;
+  std::unordered_map<std::uint64_t, std::vector<int> > cells;
+};
+
+}
+
+#endif
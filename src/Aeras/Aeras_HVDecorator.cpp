@@ -81,7 +81,7 @@ Teuchos::RCP<Tpetra_CrsMatrix> getOnlyNonzeros (const Teuchos::RCP<Tpetra_CrsMat
 Aeras::HVDecorator::HVDecorator(
     const Teuchos::RCP<Albany::Application>& app_,
     const Teuchos::RCP<Teuchos::ParameterList>& appParams)
-    :Albany::ModelEvaluatorT(app_,appParams)
+    :Albany::ModelEvaluatorT(app_,appParams), matrix_free_(false)
 {
 
 #ifdef OUTPUT_TO_SCREEN
@@ -93,6 +93,31 @@ Aeras::HVDecorator::HVDecorator(
   const bool SW_app = (appname == "Aeras Shallow Water 3D");
   const bool Hydro_app = (appname == "Aeras Hydrostatic");
 
+  const std::string problem_list = SW_app ? "Shallow Water Problem" : "Hydrostatic Problem";
+  matrix_free_ = app->getProblemPL()->sublist(problem_list).get<bool>("Matrix-Free Hyperviscosity", false);
+  //The hydrostatic Laplace operator is only built by the Jacobian specialization of
+  //Aeras::ComputeAndScatterJac, so it cannot be applied through a Residual fill.
+  TEUCHOS_TEST_FOR_EXCEPTION(matrix_free_ && !SW_app, std::logic_error,
+                             "Error! Matrix-Free Hyperviscosity is only available for Aeras Shallow Water 3D.\n");
+
+  if (matrix_free_) {
+    //Only the lumped mass diagonal is stored. The spectral element mass matrix
+    //is diagonal, so it is recovered as M*1 from a single Tangent fill.
+    const Teuchos::RCP<const Tpetra_Vector> xT = ConverterT::getConstTpetraVector(this->getNominalValues().get_x());
+    zero_xdot_ = Teuchos::rcp(new Tpetra_Vector(xT->getMap(), true));
+    zero_xdotdot_ = Teuchos::rcp(new Tpetra_Vector(xT->getMap(), true));
+    Tpetra_Vector ones(xT->getMap());
+    ones.putScalar(1.0);
+    inv_mass_diag_ = Teuchos::rcp(new Tpetra_Vector(xT->getMap(), true));
+    app->computeGlobalTangentT(1.0, 0.0, 0.0, 0.0, false, zero_xdot_.get(), zero_xdotdot_.get(), *xT,
+                               sacado_param_vec, NULL, NULL, &ones, NULL, NULL, NULL,
+                               inv_mass_diag_.get(), NULL);
+    inv_mass_diag_->reciprocal(*inv_mass_diag_);
+    wrk_ = Teuchos::rcp(new Tpetra_Vector(xT->getMap()));
+    xtildeT = Teuchos::rcp(new Tpetra_Vector(xT->getMap()));
+    return;
+  }
+
   // Create and store mass and Laplacian operators (in CrsMatrix form). 
   Teuchos::RCP<Tpetra_CrsMatrix> mass;
   if(SW_app)
@@ -215,6 +240,14 @@ const
   std::cout << "DEBUG: " << __PRETTY_FUNCTION__ << "\n";
 #endif
 
+  if (matrix_free_) {
+    // Same sequence as below, with the Laplace operator applied element by element
+    applyLaplace(*x_in, *x_in, *x_out);
+    wrk_->elementWiseMultiply(1.0, *inv_mass_diag_, *x_out, 0.0);
+    applyLaplace(*x_in, *wrk_, *x_out);
+    return;
+  }
+
   // x_out = laplace_ * x_in
   laplace_->apply(*x_in, *x_out, Teuchos::NO_TRANS, 1.0, 0.0); 
   // wrk_ = inv(M) * x_out
@@ -242,6 +275,20 @@ const
 }
 
 
+//Lv = laplace*v. With omega = n_coeff = 1 and alpha = beta = 0, ShallowWaterResid
+//only forms the hyperviscosity Laplacian of x_dotdot, so a Residual fill with v in
+//x_dotdot applies the same element kernel that createOperator differentiates, in
+//plain doubles. The operator does not depend on x, which is only gathered.
+void
+Aeras::HVDecorator::applyLaplace(const Tpetra_Vector& x, const Tpetra_Vector& v, Tpetra_Vector& Lv)
+const
+{
+#ifdef OUTPUT_TO_SCREEN
+  std::cout << "DEBUG: " << __PRETTY_FUNCTION__ << "\n";
+#endif
+  app->computeGlobalLaplaceT(0.0, zero_xdot_.get(), v, x, sacado_param_vec, Lv);
+}
+
 //og: do I have to copy/paste this from AMET.cpp?
 namespace {
 // As of early Jan 2015, it seems there is some conflict between Thyra's use of
@@ -36,6 +36,9 @@ public:
 
   void applyLinvML(Teuchos::RCP<const Tpetra_Vector> x_in, Teuchos::RCP<Tpetra_Vector> x_out) const; 
 
+  //Laplace operator applied element by element through a Residual fill, without assembling it
+  void applyLaplace(const Tpetra_Vector& x, const Tpetra_Vector& v, Tpetra_Vector& Lv) const;
+
 protected:
 
   //! Evaluate model on InArgs
@@ -48,6 +51,10 @@ private:
   Teuchos::RCP<Tpetra_CrsMatrix> laplace_; 
   Teuchos::RCP<Tpetra_Vector> inv_mass_diag_, wrk_;
   Teuchos::RCP<Tpetra_Vector> xtildeT; 
+
+  //Matrix-free mode: laplace_ is not formed, and zero rates are used for the fills
+  bool matrix_free_;
+  Teuchos::RCP<Tpetra_Vector> zero_xdot_, zero_xdotdot_;
 };
 
 }
@@ -112,7 +112,9 @@ postRegistrationSetup(typename Traits::SetupData d,
   }
 
   std::vector<PHX::index_size_type> ddims_;
-#ifdef  ALBANY_FAST_FELIX
+#if defined(ALBANY_SFAD)
+  ddims_.push_back(ALBANY_SFAD_SIZE);
+#elif defined(ALBANY_FAST_FELIX)
   ddims_.push_back(ALBANY_SLFAD_SIZE);
 #else
   ddims_.push_back(95);
@@ -14,6 +14,7 @@
 
 #include "Aeras_Layouts.hpp"
 #include "Aeras_Dimension.hpp"
+#include "Aeras_TensorProductStencil.hpp"
 
 namespace Aeras {
 /** \brief Finite Element Interpolation Evaluator
@@ -64,6 +65,7 @@ private:
 
   Kokkos::DynRankView<RealType, PHX::Device>    grad_at_cub_points;
   Kokkos::DynRankView<ScalarT, PHX::Device>     vcontra;
+  TensorProductStencil                          stencil;
 
   const int numNodes;
   const int numDims;
@@ -68,8 +68,9 @@ postRegistrationSetup(typename Traits::SetupData d,
   cubature->getCubature(refPoints, refWeights);
   intrepidBasis->getValues(grad_at_cub_points, refPoints, Intrepid2::OPERATOR_GRAD);
 
+  stencil = TensorProductStencil(grad_at_cub_points);
 #ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
-  vcontra = Kokkos::createDynRankView(val_node.get_view(), "XXX", numNodes, 2);
+  vcontra = Kokkos::createDynRankView(val_node.get_view(), "XXX", numNodes, numLevels, 2);
 #endif
 }
 
@@ -80,16 +81,7 @@ template<typename EvalT, typename Traits>
 KOKKOS_INLINE_FUNCTION
 void DOFDivInterpolationLevels<EvalT, Traits>::
 operator() (const DOFDivInterpolationLevels_originalDiv_Tag& tag, const int& cell) const{
-  for (int qp=0; qp < numQPs; ++qp) {
-    for (int level=0; level < numLevels; ++level) {
-      div_val_qp(cell,qp,level) = 0;
-      for (int node= 0 ; node < numNodes; ++node) {
-        for (int dim=0; dim<numDims; dim++) {
-          div_val_qp(cell,qp,level) += val_node(cell,node,level,dim) * GradBF(cell,node,qp,dim);
-        }
-      }
-    }
-  }
+  stencil.divergenceLevels(val_node, GradBF, div_val_qp, cell, numLevels, numDims);
 }
 
 template<typename EvalT, typename Traits>
@@ -109,15 +101,21 @@ operator() (const DOFDivInterpolationLevels_Tag& tag, const int& cell) const{
     }
   }
 
+  // Sum factorized on tensor-product elements, see Aeras::TensorProductStencil
   for (int qp=0; qp < numQPs; ++qp) {
-    for (int level=0; level < numLevels; ++level) {
+    for (int level=0; level < numLevels; ++level)
       div_val_qp(cell, qp, level) = 0;
-      for (int node=0; node < numNodes; ++node) {
-        div_val_qp(cell, qp, level) += vcontra(cell, node, level, 0)*grad_at_cub_points(node, qp, 0)
-                                    +  vcontra(cell, node, level, 1)*grad_at_cub_points(node, qp, 1);
+    for (int dir=0; dir < 2; ++dir) {
+      for (int k=stencil.begin(qp,dir); k < stencil.end(qp,dir); ++k) {
+        const int node = stencil.node(k);
+        const RealType w = stencil.weight(k);
+        for (int level=0; level < numLevels; ++level)
+          div_val_qp(cell, qp, level) += vcontra(cell, node, level, dir)*w;
       }
-      div_val_qp(cell, qp, level) /= jacobian_det(cell, qp);
     }
+    const MeshScalarT det_j = jacobian_det(cell, qp);
+    for (int level=0; level < numLevels; ++level)
+      div_val_qp(cell, qp, level) /= det_j;
   }
 }
 
@@ -129,45 +127,33 @@ void DOFDivInterpolationLevels<EvalT, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
 #ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
+  // Both forms are sum factorized on tensor-product elements, see Aeras::TensorProductStencil
   if ( originalDiv ) {
-    for (int cell=0; cell < workset.numCells; ++cell) {
-      for (int qp=0; qp < numQPs; ++qp) {
-        for (int level=0; level < numLevels; ++level) {
-          div_val_qp(cell,qp,level) = 0;
-          for (int node= 0 ; node < numNodes; ++node) {
-            for (int dim=0; dim<numDims; dim++) {
-              div_val_qp(cell,qp,level) += val_node(cell,node,level,dim) * GradBF(cell,node,qp,dim);
-            }
-          }
-        }
-      }
-    }
+    for (int cell=0; cell < workset.numCells; ++cell)
+      stencil.divergenceLevels(val_node, GradBF, div_val_qp, cell, numLevels, numDims);
   }//end of original div
 
   else {
-    //rather slow, needs revision
     for (int cell=0; cell < workset.numCells; ++cell) {
-      for (int level=0; level < numLevels; ++level) {
-        for (std::size_t node=0; node < numNodes; ++node) {
-          const MeshScalarT jinv00 = jacobian_inv(cell, node, 0, 0);
-          const MeshScalarT jinv01 = jacobian_inv(cell, node, 0, 1);
-          const MeshScalarT jinv10 = jacobian_inv(cell, node, 1, 0);
-          const MeshScalarT jinv11 = jacobian_inv(cell, node, 1, 1);
-          const MeshScalarT det_j  = jacobian_det(cell,node);
-
-          vcontra(node, 0 ) = det_j*(jinv00*val_node(cell, node, level, 0) + jinv01*val_node(cell, node, level, 1) );
-          vcontra(node, 1 ) = det_j*(jinv10*val_node(cell, node, level, 0) + jinv11*val_node(cell, node, level, 1) );
-        }//end of nodal loop
-
-        for (int qp=0; qp < numQPs; ++qp) {
-          div_val_qp(cell, qp, level) = 0;
-          for (int node=0; node < numNodes; ++node) {
-            div_val_qp(cell, qp, level) += vcontra(node, 0)*grad_at_cub_points(node, qp, 0)
-                                        +  vcontra(node, 1)*grad_at_cub_points(node, qp, 1);
-          }
-          div_val_qp(cell, qp, level) /= jacobian_det(cell,qp);
+      for (std::size_t node=0; node < numNodes; ++node) {
+        const MeshScalarT jinv00 = jacobian_inv(cell, node, 0, 0);
+        const MeshScalarT jinv01 = jacobian_inv(cell, node, 0, 1);
+        const MeshScalarT jinv10 = jacobian_inv(cell, node, 1, 0);
+        const MeshScalarT jinv11 = jacobian_inv(cell, node, 1, 1);
+        const MeshScalarT det_j  = jacobian_det(cell,node);
+
+        for (int level=0; level < numLevels; ++level) {
+          vcontra(node, level, 0) = det_j*(jinv00*val_node(cell, node, level, 0) + jinv01*val_node(cell, node, level, 1) );
+          vcontra(node, level, 1) = det_j*(jinv10*val_node(cell, node, level, 0) + jinv11*val_node(cell, node, level, 1) );
         }
-      }//end level loop
+      }//end of nodal loop
+
+      for (int qp=0; qp < numQPs; ++qp) {
+        stencil.refDivergence(vcontra, div_val_qp, cell, qp, numLevels);
+        const MeshScalarT det_j = jacobian_det(cell,qp);
+        for (int level=0; level < numLevels; ++level)
+          div_val_qp(cell, qp, level) /= det_j;
+      }
     }//end of cell loop
   }//end of new div
 
@@ -14,6 +14,7 @@
 
 #include "Aeras_Layouts.hpp"
 #include "Aeras_Dimension.hpp"
+#include "Aeras_TensorProductStencil.hpp"
 
 namespace Aeras {
 /** \brief Finite Element Interpolation Evaluator
@@ -52,6 +53,11 @@ private:
   //! Values at quadrature points
   PHX::MDField<ScalarT,Cell,QuadPoint,Level,Dim> grad_val_qp;
 
+  //! Optional; if given, only the nodes on the support of GradBF are summed
+  Teuchos::RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> > intrepidBasis;
+  Teuchos::RCP<Intrepid2::Cubature<PHX::Device> > cubature;
+  TensorProductStencil stencil;
+
   const int numNodes;
   const int numDims;
   const int numQPs;
@@ -29,6 +29,11 @@ DOFGradInterpolationLevels(Teuchos::ParameterList& p,
   this->addDependentField(GradBF);
   this->addEvaluatedField(grad_val_qp);
 
+  if (p.isParameter("Intrepid2 Basis")) {
+    intrepidBasis = p.get<Teuchos::RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> > > ("Intrepid2 Basis");
+    cubature      = p.get<Teuchos::RCP <Intrepid2::Cubature<PHX::Device> > >("Cubature");
+  }
+
   this->setName("Aeras::DOFGradInterpolationLevels"+PHX::typeAsString<EvalT>());
 
   //std::cout << "Aeras::DOFGradInterpolationLevels: " << numDims << " " << numQPs << " " << numLevels << std::endl;
@@ -43,6 +48,9 @@ postRegistrationSetup(typename Traits::SetupData d,
   this->utils.setFieldData(val_node,fm);
   this->utils.setFieldData(GradBF,fm);
   this->utils.setFieldData(grad_val_qp,fm);
+
+  if (intrepidBasis != Teuchos::null)
+    stencil = TensorProductStencil(intrepidBasis, cubature);
 }
 
 //**********************************************************************
@@ -52,6 +60,10 @@ template<typename EvalT, typename Traits>
 KOKKOS_INLINE_FUNCTION
 void DOFGradInterpolationLevels<EvalT, Traits>::
 operator() (const DOFGradInterpolationLevels_Tag& tag, const int& cell) const{
+  if (!stencil.empty()) {
+    stencil.gradientLevels(val_node, GradBF, grad_val_qp, cell, numLevels, numDims);
+    return;
+  }
   for (int qp=0; qp < numQPs; ++qp) {
     for (int level=0; level < numLevels; ++level) {
       for (int dim=0; dim<numDims; dim++) {
@@ -102,13 +114,20 @@ evaluateFields(typename Traits::EvalData workset)
   }
   */
 
-  for (int cell=0; cell < workset.numCells; ++cell) {
-    for (int qp=0; qp < numQPs; ++qp) {
-      for (int level=0; level < numLevels; ++level) {
-        for (int dim=0; dim<numDims; dim++) {
-          grad_val_qp(cell,qp,level,dim) = 0;
-          for (int node= 0 ; node < numNodes; ++node) {
-            grad_val_qp(cell,qp,level,dim) += val_node(cell, node, level) * GradBF(cell, node, qp, dim);
+  if (!stencil.empty()) {
+    // Sum factorized on tensor-product elements, see Aeras::TensorProductStencil
+    for (int cell=0; cell < workset.numCells; ++cell)
+      stencil.gradientLevels(val_node, GradBF, grad_val_qp, cell, numLevels, numDims);
+  }
+  else {
+    for (int cell=0; cell < workset.numCells; ++cell) {
+      for (int qp=0; qp < numQPs; ++qp) {
+        for (int level=0; level < numLevels; ++level) {
+          for (int dim=0; dim<numDims; dim++) {
+            grad_val_qp(cell,qp,level,dim) = 0;
+            for (int node= 0 ; node < numNodes; ++node) {
+              grad_val_qp(cell,qp,level,dim) += val_node(cell, node, level) * GradBF(cell, node, qp, dim);
+            }
           }
         }
       }
@@ -47,11 +47,23 @@ void GatherCoordinateVector<EvalT, Traits>::evaluateFields(typename Traits::Eval
 
   unsigned int numCells = workset.numCells;
   Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*> > wsCoords = workset.wsCoords;
+  const Albany::AbstractDiscretization::WorksetCoords& packedCoords = workset.wsPackedCoords;
 
-  for (std::size_t cell=0; cell < numCells; ++cell) {
-    for (std::size_t node = 0; node < numNodes; ++node) {
-      for (std::size_t i=0; i < numCoords; ++i) { 
-        coordVec(cell,node,i) = wsCoords[cell][node][i]; 
+  if (packedCoords.size() > 0) {
+    // The packed coordinates are contiguous along the cells
+    for (std::size_t i=0; i < numCoords; ++i) {
+      for (std::size_t node = 0; node < numNodes; ++node) {
+        for (std::size_t cell=0; cell < numCells; ++cell) {
+          coordVec(cell,node,i) = packedCoords(cell,node,i);
+        }
+      }
+    }
+  } else {
+    for (std::size_t cell=0; cell < numCells; ++cell) {
+      for (std::size_t node = 0; node < numNodes; ++node) {
+        for (std::size_t i=0; i < numCoords; ++i) { 
+          coordVec(cell,node,i) = wsCoords[cell][node][i]; 
+        }
       }
     }
   }
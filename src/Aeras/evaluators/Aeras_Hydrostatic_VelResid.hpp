@@ -13,6 +13,7 @@
 #include "Phalanx_MDField.hpp"
 #include "Aeras_Layouts.hpp"
 #include "Aeras_Dimension.hpp"
+#include "Aeras_TensorProductStencil.hpp"
 
 namespace Aeras {
 /** \brief Hydrostatic equation Residual for atmospheric modeling
@@ -45,6 +46,8 @@ private:
   Kokkos::DynRankView<RealType, PHX::Device>    refPoints;
   Kokkos::DynRankView<RealType, PHX::Device>    refWeights;
   Kokkos::DynRankView<RealType, PHX::Device>    grad_at_cub_points;
+  //! Built if "Intrepid2 Basis" is given, otherwise the viscous term sums over every node
+  TensorProductStencil stencil;
 
   // vorticity only returns the component in the radial direction
   //void get_vorticity(const Kokkos::DynRankView<ScalarT, PHX::Device>  & fieldAtNodes,
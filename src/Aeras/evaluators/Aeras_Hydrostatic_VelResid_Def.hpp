@@ -76,6 +76,11 @@ Hydrostatic_VelResid(const Teuchos::ParameterList& p,
 
   this->addEvaluatedField(Residual);
 
+  if (p.isParameter("Intrepid2 Basis")) {
+    intrepidBasis = p.get<Teuchos::RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> > > ("Intrepid2 Basis");
+    cubature      = p.get<Teuchos::RCP <Intrepid2::Cubature<PHX::Device> > >("Cubature");
+  }
+
   this->setName("Aeras::Hydrostatic_VelResid" + PHX::typeAsString<EvalT>());
 
   //refWeights        .resize               (numQPs);
@@ -110,6 +115,9 @@ postRegistrationSetup(typename Traits::SetupData d,
   this->utils.setFieldData(jacobian_det, fm);
 
   this->utils.setFieldData(Residual,fm);
+
+  if (intrepidBasis != Teuchos::null)
+    stencil = TensorProductStencil(intrepidBasis, cubature);
 }
 
 //**********************************************************************
@@ -139,11 +147,22 @@ operator() (const Hydrostatic_VelResid_Tag& tag, const int& cell) const{
       Residual(cell,node,level,0) *= wBF(cell,node,node);
       Residual(cell,node,level,1) *= wBF(cell,node,node);
     }
+  }
+  if (stencil.empty()) {
+    for (int node=0; node < numNodes; ++node)
+      for (int qp=0; qp < numQPs; ++qp)
+        for (int level = 0; level < 2; ++level )
+          for (int dim = 0; dim < numDims; ++dim)
+            Residual(cell, node, level, dim) += viscosity * DVelx(cell, qp, level, dim) * wGradBF(cell, node, qp, dim);
+  }
+  else {
+    // Only the nodes on the support of wGradBF at qp, see Aeras::TensorProductStencil
     for (int qp=0; qp < numQPs; ++qp) {
-      for (int level = 0; level < 2; ++level ) {
-        for (int dim = 0; dim < numDims; ++dim) {
-          Residual(cell, node, level, dim) += viscosity * DVelx(cell, qp, level, dim) * wGradBF(cell, node, qp, dim);  
-    	}
+      for (int k=stencil.supportBegin(qp); k < stencil.supportEnd(qp); ++k) {
+        const int node = stencil.supportNode(k);
+        for (int level = 0; level < 2; ++level )
+          for (int dim = 0; dim < numDims; ++dim)
+            Residual(cell, node, level, dim) += viscosity * DVelx(cell, qp, level, dim) * wGradBF(cell, node, qp, dim);
       }
     }
   }
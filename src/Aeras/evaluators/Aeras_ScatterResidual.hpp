@@ -136,6 +136,7 @@ public:
 private:
   int neq, nunk;
   Tpetra_CrsMatrix::local_matrix_type JacT_kokkos;
+  Albany::AbstractDiscretization::WorksetJacOffsets jacOffsets;
 
   typedef ScatterResidualBase<PHAL::AlbanyTraits::Jacobian, Traits> Base;
   using Base::nodeID;
@@ -237,7 +237,12 @@ operator() (const Aeras_ScatterJac_Adjoint_Tag&, const int& cell) const{
         for (int eq_col=0; eq_col<neq; eq_col++, i++) {
           const LO colT = nodeID(cell,node_col,eq_col);
           const ST val = valptr.fastAccessDx(i);
-          if (val != 0) 
+          if (val == 0) continue;
+          if (jacOffsets.size() != 0) {
+            const LO off = jacOffsets(cell,i,neq*node+n);
+            if (off >= 0) Kokkos::atomic_fetch_add(&JacT_kokkos.values(off), val);
+          }
+          else
             JacT_kokkos.sumIntoValues(colT, &rowT,  1, &val, false, true);
         }
       }
@@ -253,7 +258,12 @@ operator() (const Aeras_ScatterJac_Adjoint_Tag&, const int& cell) const{
             for (int eq_col=0; eq_col<neq; eq_col++, i++) {
               const LO colT = nodeID(cell,node_col,eq_col);
               const ST val = valptr.fastAccessDx(i);
-              if (val != 0) 
+              if (val == 0) continue;
+              if (jacOffsets.size() != 0) {
+                const LO off = jacOffsets(cell,i,neq*node+n);
+                if (off >= 0) Kokkos::atomic_fetch_add(&JacT_kokkos.values(off), val);
+              }
+              else
                 JacT_kokkos.sumIntoValues(colT, &rowT,  1, &val, false, true);
             }
           }
@@ -267,7 +277,12 @@ operator() (const Aeras_ScatterJac_Adjoint_Tag&, const int& cell) const{
             for (int eq_col=0; eq_col<neq; eq_col++, i++) {
               const LO colT = nodeID(cell,node_col,eq_col);
               const ST val = valptr.fastAccessDx(i);
-              if (val != 0) 
+              if (val == 0) continue;
+              if (jacOffsets.size() != 0) {
+                const LO off = jacOffsets(cell,i,neq*node+n);
+                if (off >= 0) Kokkos::atomic_fetch_add(&JacT_kokkos.values(off), val);
+              }
+              else
                 JacT_kokkos.sumIntoValues(colT, &rowT,  1, &val, false, true);
             }
           }
@@ -284,7 +299,12 @@ operator() (const Aeras_ScatterJac_Adjoint_Tag&, const int& cell) const{
           for (int eq_col=0; eq_col<neq; eq_col++, i++) {
             const LO colT = nodeID(cell,node_col,eq_col);
             const ST val = valptr.fastAccessDx(i);
-            if (val != 0) 
+            if (val == 0) continue;
+            if (jacOffsets.size() != 0) {
+              const LO off = jacOffsets(cell,i,neq*node+n);
+              if (off >= 0) Kokkos::atomic_fetch_add(&JacT_kokkos.values(off), val);
+            }
+            else
               JacT_kokkos.sumIntoValues(colT, &rowT,  1, &val, false, true);
           }
         }
@@ -307,7 +327,12 @@ operator() (const Aeras_ScatterJac_Tag&, const int& cell) const{
         for (int eq_col=0; eq_col<neq; eq_col++, i++) {
           const LO colT = nodeID(cell,node_col,eq_col);
           const ST val = valptr.fastAccessDx(i);
-          if (val != 0) 
+          if (val == 0) continue;
+          if (jacOffsets.size() != 0) {
+            const LO off = jacOffsets(cell,neq*node+n,i);
+            if (off >= 0) Kokkos::atomic_fetch_add(&JacT_kokkos.values(off), val);
+          }
+          else
             JacT_kokkos.sumIntoValues(rowT, &colT,  1, &val, false, true);
         }
       }
@@ -323,7 +348,12 @@ operator() (const Aeras_ScatterJac_Tag&, const int& cell) const{
             for (int eq_col=0; eq_col<neq; eq_col++, i++) {
               const LO colT = nodeID(cell,node_col,eq_col);
               const ST val = valptr.fastAccessDx(i);
-              if (val != 0) 
+              if (val == 0) continue;
+              if (jacOffsets.size() != 0) {
+                const LO off = jacOffsets(cell,neq*node+n,i);
+                if (off >= 0) Kokkos::atomic_fetch_add(&JacT_kokkos.values(off), val);
+              }
+              else
                 JacT_kokkos.sumIntoValues(rowT, &colT,  1, &val, false, true);
             }
           }
@@ -337,7 +367,12 @@ operator() (const Aeras_ScatterJac_Tag&, const int& cell) const{
             for (int eq_col=0; eq_col<neq; eq_col++, i++) {
               const LO colT = nodeID(cell,node_col,eq_col);
               const ST val = valptr.fastAccessDx(i);
-              if (val != 0) 
+              if (val == 0) continue;
+              if (jacOffsets.size() != 0) {
+                const LO off = jacOffsets(cell,neq*node+n,i);
+                if (off >= 0) Kokkos::atomic_fetch_add(&JacT_kokkos.values(off), val);
+              }
+              else
                 JacT_kokkos.sumIntoValues(rowT, &colT,  1, &val, false, true);
             }
           }
@@ -354,7 +389,12 @@ operator() (const Aeras_ScatterJac_Tag&, const int& cell) const{
           for (int eq_col=0; eq_col<neq; eq_col++, i++) {
             const LO colT = nodeID(cell,node_col,eq_col);
             const ST val = valptr.fastAccessDx(i);
-            if (val != 0) 
+            if (val == 0) continue;
+            if (jacOffsets.size() != 0) {
+              const LO off = jacOffsets(cell,neq*node+n,i);
+              if (off >= 0) Kokkos::atomic_fetch_add(&JacT_kokkos.values(off), val);
+            }
+            else
               JacT_kokkos.sumIntoValues(rowT, &colT,  1, &val, false, true);
           }
         }
@@ -380,6 +420,20 @@ evaluateFields(typename Traits::EvalData workset)
   LO rowT; 
   Teuchos::Array<LO> colT; 
 
+  // With precomputed offsets the derivatives are added directly into the
+  // matrix values, skipping the column search in sumIntoLocalValues
+  const auto& jacOffsets = workset.wsJacOffsets;
+  const bool useOffsets = jacOffsets.size() != 0;
+  Tpetra_CrsMatrix::local_matrix_type::values_type JacT_values;
+  if (useOffsets) JacT_values = JacT->getLocalMatrix().values;
+  auto sumIntoJacobianByOffsets = [&](const int cell, const int row_unk, const ScalarT& valptr) {
+    for (int lunk = 0; lunk < colT.size(); ++lunk) {
+      const LO off = workset.is_adjoint ?
+        jacOffsets(cell,lunk,row_unk) : jacOffsets(cell,row_unk,lunk);
+      if (off >= 0) JacT_values(off) += valptr.fastAccessDx(lunk);
+    }
+  };
+
   for (int cell=0; cell < workset.numCells; ++cell ) {
     const int neq = nodeID.dimension(2);
     colT.resize(neq * this->numNodes);
@@ -396,7 +450,10 @@ evaluateFields(typename Traits::EvalData workset)
         rowT = nodeID(cell,node,n);
         if (loadResid) fT->sumIntoLocalValue(rowT, valptr.val());
         if (valptr.hasFastAccess()) {
-          if (workset.is_adjoint) {
+          if (useOffsets) {
+            sumIntoJacobianByOffsets(cell, neq*node + n, valptr);
+          }
+          else if (workset.is_adjoint) {
             // Sum Jacobian transposed
             for (unsigned int i=0; i<colT.size(); ++i) {
               ST val = valptr.fastAccessDx(i); 
@@ -426,7 +483,10 @@ evaluateFields(typename Traits::EvalData workset)
             rowT = nodeID(cell,node,n);
             if (loadResid) fT->sumIntoLocalValue(rowT, valptr.val());
             if (valptr.hasFastAccess()) {
-              if (workset.is_adjoint) {
+              if (useOffsets) {
+                sumIntoJacobianByOffsets(cell, neq*node + n, valptr);
+              }
+              else if (workset.is_adjoint) {
                 // Sum Jacobian transposed
                 for (int i=0; i<colT.size(); ++i) {
                   ST val = valptr.fastAccessDx(i); 
@@ -455,7 +515,10 @@ evaluateFields(typename Traits::EvalData workset)
           rowT = nodeID(cell,node,n);
           if (loadResid) fT->sumIntoLocalValue(nodeID(cell,node,n), valptr.val());
           if (valptr.hasFastAccess()) {
-            if (workset.is_adjoint) {
+            if (useOffsets) {
+              sumIntoJacobianByOffsets(cell, neq*node + n, valptr);
+            }
+            else if (workset.is_adjoint) {
               // Sum Jacobian transposed
               for (unsigned int i=0; i<colT.size(); ++i) {
                 ST val = valptr.fastAccessDx(i); 
@@ -485,7 +548,10 @@ evaluateFields(typename Traits::EvalData workset)
           rowT = nodeID(cell,node,n);
           if (loadResid) fT->sumIntoLocalValue(nodeID(cell,node,n), valptr.val());
           if (valptr.hasFastAccess()) {
-            if (workset.is_adjoint) {
+            if (useOffsets) {
+              sumIntoJacobianByOffsets(cell, neq*node + n, valptr);
+            }
+            else if (workset.is_adjoint) {
               // Sum Jacobian transposed
               for (unsigned int i=0; i<colT.size(); ++i) {
                 ST val = valptr.fastAccessDx(i); 
@@ -531,6 +597,7 @@ evaluateFields(typename Traits::EvalData workset)
   if (!JacT->isFillComplete())
     JacT->fillComplete();
   JacT_kokkos = JacT->getLocalMatrix();
+  jacOffsets = workset.wsJacOffsets;
 
   // Get MDField views from std::vector
   for (int i = 0; i < this->numFields; i++) {
@@ -13,6 +13,7 @@
 #include "Phalanx_MDField.hpp"
 #include "Albany_Layouts.hpp"
 #include "Sacado_ParameterAccessor.hpp"
+#include "Aeras_TensorProductStencil.hpp"
 
 #include <Shards_CellTopology.hpp>
 #include <Intrepid2_Basis.hpp>
@@ -91,6 +92,7 @@ private:
 	Teuchos::RCP<Intrepid2::Cubature<PHX::Device> > cubature;
 	Kokkos::DynRankView<RealType, PHX::Device>    refPoints;
 	Kokkos::DynRankView<RealType, PHX::Device>    refWeights;
+	TensorProductStencil stencil;
 #ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
 	Kokkos::DynRankView<MeshScalarT, PHX::Device>  nodal_jacobian;
 	Kokkos::DynRankView<MeshScalarT, PHX::Device>  nodal_inv_jacobian;
@@ -251,6 +251,8 @@ postRegistrationSetup(typename Traits::SetupData d,
   cubature->getCubature(refPoints, refWeights);
   intrepidBasis->getValues(grad_at_cub_points, refPoints, Intrepid2::OPERATOR_GRAD);
 
+  stencil = TensorProductStencil(grad_at_cub_points);
+
 #ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
   nodal_jacobian = Kokkos::createDynRankView(wBF.get_view(), "XXX", numNodes, 2, 2);
   nodal_inv_jacobian = Kokkos::createDynRankView(wBF.get_view(), "XXX", numNodes, 2, 2);
@@ -351,16 +353,12 @@ void ShallowWaterResid<EvalT,Traits>::divergence4(const Kokkos::DynRankView<Scal
     tempnodalvec1(cell, node, 1 ) = det_j*(jinv10*fieldAtNodes(cell, node, 0) + jinv11*fieldAtNodes(cell, node, 1) );
   }
 
+  // Sum factorized on tensor-product elements, see Aeras::TensorProductStencil
   for (int qp=0; qp < numQPs; ++qp) {
     div_(cell, qp) = 0.0;
-    for (int node=0; node < numNodes; ++node) {
-      //OG What is this commented code?
-      //ScalarT tempAdd =vcontra(node, 0)*grad_at_cub_points_Kokkos(node, qp,0)
-      //                + vcontra(node, 1)*grad_at_cub_points_Kokkos(node, qp,1);
-      //     Kokkos::atomic_fetch_add(&div_hU(qp), tempAdd);
-      div_(cell, qp) += tempnodalvec1(cell, node, 0)*grad_at_cub_points_Kokkos(node, qp, 0)
-                     +  tempnodalvec1(cell, node, 1)*grad_at_cub_points_Kokkos(node, qp, 1);
-    }
+    for (int dir=0; dir < 2; ++dir)
+      for (int k=stencil.begin(qp,dir); k < stencil.end(qp,dir); ++k)
+        div_(cell, qp) += tempnodalvec1(cell, stencil.node(k), dir)*stencil.weight(k);
   }
 
   for (int qp=0; qp < numQPs; ++qp) {
@@ -384,12 +382,10 @@ gradient4(const Kokkos::DynRankView<ScalarT, PHX::Device>  & field,
   for (std::size_t qp=0; qp < numQPs; ++qp) {
     ScalarT gx = 0;
     ScalarT gy = 0;
-    for (std::size_t node=0; node < numNodes; ++node) {
-      //const typename PHAL::Ref<const ScalarT>::type
-      const ScalarT field_ = field(cell,node);
-      gx += field_*grad_at_cub_points_Kokkos(node, qp,0);
-      gy += field_*grad_at_cub_points_Kokkos(node, qp,1);
-    }
+    for (int k=stencil.begin(qp,0); k < stencil.end(qp,0); ++k)
+      gx += field(cell,stencil.node(k))*stencil.weight(k);
+    for (int k=stencil.begin(qp,1); k < stencil.end(qp,1); ++k)
+      gy += field(cell,stencil.node(k))*stencil.weight(k);
 
     gradient_(cell,qp, 0) = jacobian_inv(cell, qp, 0, 0)*gx + jacobian_inv(cell, qp, 1, 0)*gy;
     gradient_(cell,qp, 1) = jacobian_inv(cell, qp, 0, 1)*gx + jacobian_inv(cell, qp, 1, 1)*gy;
@@ -421,10 +417,10 @@ void ShallowWaterResid<EvalT,Traits>::curl4(
   }
   for (int qp=0; qp < numQPs; ++qp) {
     curl_(cell, qp) = 0.0;
-    for (int node=0; node < numNodes; ++node) {
-      curl_(cell, qp) += tempnodalvec2(cell, node, 1)*grad_at_cub_points_Kokkos(node, qp, 0)
-      		      -  tempnodalvec2(cell, node, 0)*grad_at_cub_points_Kokkos(node, qp, 1);
-    }
+    for (int k=stencil.begin(qp,0); k < stencil.end(qp,0); ++k)
+      curl_(cell, qp) += tempnodalvec2(cell, stencil.node(k), 1)*stencil.weight(k);
+    for (int k=stencil.begin(qp,1); k < stencil.end(qp,1); ++k)
+      curl_(cell, qp) -= tempnodalvec2(cell, stencil.node(k), 0)*stencil.weight(k);
     curl_(cell, qp) = curl_(cell, qp)/jacobian_det(cell, qp);
   }
 }
@@ -1125,6 +1121,103 @@ evaluateFields(typename Traits::EvalData workset)
   Kokkos::DynRankView<ScalarT, PHX::Device> utYgradNodes = Kokkos::createDynRankView(U.get_view(),"ASW",numQPs,2);
   Kokkos::DynRankView<ScalarT, PHX::Device> utZgradNodes = Kokkos::createDynRankView(U.get_view(),"ASW",numQPs,2);
 
+  //In case of Explicit Hyperviscosity we form Laplace operator if omega=n=1 .
+  //This code should not be executed if hv coefficient is zero, the check
+  //is in Albany_SolverFactory.
+  //As in the Kokkos version below, nothing else is added to the residual then:
+  //the rest has a zero derivative for alpha=beta=0, and a Residual fill
+  //(Albany::Application::computeGlobalLaplaceT) gives the Laplacian applied to x_dotdot.
+  if (useExplHyperviscosity && obtainLaplaceOp) {
+    for (std::size_t cell=0; cell < workset.numCells; ++cell) {
+      Kokkos::deep_copy(surftilde,0.0);
+      Kokkos::deep_copy(htildegradNodes,0.0);
+      for (std::size_t node=0; node < numNodes; ++node)
+        surftilde(node) = UDotDotNodal(cell,node,0);
+      gradient(surftilde, cell, htildegradNodes);
+
+      for (std::size_t qp=0; qp < numQPs; ++qp) {
+        for (std::size_t node=0; node < numNodes; ++node) {
+          Residual(cell,node,0) += sHvTau*htildegradNodes(qp,0)*wGradBF(cell,node,qp,0)
+                                +  sHvTau*htildegradNodes(qp,1)*wGradBF(cell,node,qp,1);
+          //OG: This doesn't quite work when hvTau=0=hyperviscosity(:,:,:) .
+          //In case of hvTau = 0, sqrt(hyperviscosity(:))=[0 | nan nan ...] and laplace op. below contains nans as well.
+          //My best guess is that this is due to automatic differentiation.
+          //Residual(cell,node,0) += sqrt(hyperviscosity(cell,qp,0))*htildegradNodes(qp,0)*wGradBF(cell,node,qp,0)
+          //                      +  sqrt(hyperviscosity(cell,qp,0))*htildegradNodes(qp,1)*wGradBF(cell,node,qp,1);
+        }
+      }
+
+      if (usePrescribedVelocity) continue;
+
+      Kokkos::deep_copy(utX,0.0);
+      Kokkos::deep_copy(utY,0.0);
+      Kokkos::deep_copy(utZ,0.0);
+      Kokkos::deep_copy(utXgradNodes,0.0);
+      Kokkos::deep_copy(utYgradNodes,0.0);
+      Kokkos::deep_copy(utZgradNodes,0.0);
+
+      for (std::size_t node=0; node < numNodes; ++node) {
+        const ScalarT utlambda = UDotDotNodal(cell, node,1);
+        const ScalarT uttheta  = UDotDotNodal(cell, node,2);
+        const typename PHAL::Ref<const MeshScalarT>::type lam = lambda_nodal(cell, node),
+                                                          th = theta_nodal(cell, node);
+        const ScalarT k11 = -sin(lam),
+                      k12 = -sin(th)*cos(lam),
+                      k21 =  cos(lam),
+                      k22 = -sin(th)*sin(lam),
+                      k32 =  cos(th);
+        utX(node) = k11*utlambda + k12*uttheta;
+        utY(node) = k21*utlambda + k22*uttheta;
+        utZ(node) = k32*uttheta;
+      }
+
+      gradient(utX, cell, utXgradNodes);
+      gradient(utY, cell, utYgradNodes);
+      gradient(utZ, cell, utZgradNodes);
+
+      for (std::size_t qp=0; qp < numQPs; ++qp) {
+        for (std::size_t node=0; node < numNodes; ++node) {
+          const typename PHAL::Ref<const MeshScalarT>::type lam = sphere_coord(cell, node, 0),
+                                                            th = sphere_coord(cell, node, 1);
+
+          //K = -sin L    -sin T cos L
+          //     cos L    -sin T sin L
+          //     0         cos T
+          //K^{-1} = K^T
+          const ScalarT k11 = -sin(lam),
+                        k12 = -sin(th)*cos(lam),
+                        k21 =  cos(lam),
+                        k22 = -sin(th)*sin(lam),
+                        k32 =  cos(th);
+
+          //Do not delete:
+          //Consider
+          //V - tensor in tensor HV formulation, not hyperviscosity coefficient,
+          //assume V = [v11 v12; v21 v22] then expressions below, for Residual(cell,node,1)
+          //would take form
+          /*     k11*( (v11*utXgradNodes(qp,0) + v12*utXgradNodes(qp,1))*wGradBF(cell,node,qp,0) +
+                 (v21*utXgradNodes(qp,0) + v22*utXgradNodes(qp,1))*wGradBF(cell,node,qp,1)
+                 )
+               + k21*( (v11*utYgradNodes(qp,0) + v12*utYgradNodes(qp,1))*wGradBF(cell,node,qp,0) +
+                 (v21*utYgradNodes(qp,0) + v22*utYgradNodes(qp,1))*wGradBF(cell,node,qp,1)
+                 )
+          */
+          Residual(cell,node,1) += sHvTau*(
+                                   k11*( utXgradNodes(qp,0)*wGradBF(cell,node,qp,0) + utXgradNodes(qp,1)*wGradBF(cell,node,qp,1))
+                                 + k21*( utYgradNodes(qp,0)*wGradBF(cell,node,qp,0) + utYgradNodes(qp,1)*wGradBF(cell,node,qp,1))
+                                 //k31 = 0
+                                 );
+          Residual(cell,node,2) += sHvTau*(
+                                   k12*( utXgradNodes(qp,0)*wGradBF(cell,node,qp,0) + utXgradNodes(qp,1)*wGradBF(cell,node,qp,1))
+                                 + k22*( utYgradNodes(qp,0)*wGradBF(cell,node,qp,0) + utYgradNodes(qp,1)*wGradBF(cell,node,qp,1))
+                                 + k32*( utZgradNodes(qp,0)*wGradBF(cell,node,qp,0) + utZgradNodes(qp,1)*wGradBF(cell,node,qp,1))
+                                 );
+        }
+      }
+    }
+    return;
+  }
+
   for (std::size_t cell=0; cell < workset.numCells; ++cell) {
     // Depth Equation (Eq# 0)
     Kokkos::deep_copy(huAtNodes,0.0);
@@ -1148,30 +1241,7 @@ evaluateFields(typename Traits::EvalData workset)
     //gradient(surf, cell, hgradNodes);
 
 
-    //In case of Explicit Hyperviscosity we form Laplace operator if omega=n=1 .
-    //This code should not be executed if hv coefficient is zero, the check
-    //is in Albany_SolverFactory.
-
     if (useExplHyperviscosity) {
-      //OG: maybe, int(n_coeff) == 1 ?
-      if (n_coeff == 1) {  
-	for (std::size_t node=0; node < numNodes; ++node)
-  	  surftilde(node) = UDotDotNodal(cell,node,0);
-	gradient(surftilde, cell, htildegradNodes);
-
-	for (std::size_t qp=0; qp < numQPs; ++qp) {
-	  for (std::size_t node=0; node < numNodes; ++node) {
-  	    Residual(cell,node,0) += sHvTau*htildegradNodes(qp,0)*wGradBF(cell,node,qp,0)
-                       		  +  sHvTau*htildegradNodes(qp,1)*wGradBF(cell,node,qp,1);
-	    //OG: This doesn't quite work when hvTau=0=hyperviscosity(:,:,:) .
-	    //In case of hvTau = 0, sqrt(hyperviscosity(:))=[0 | nan nan ...] and laplace op. below contains nans as well.
-	    //My best guess is that this is due to automatic differentiation.
-	    //Residual(cell,node,0) += sqrt(hyperviscosity(cell,qp,0))*htildegradNodes(qp,0)*wGradBF(cell,node,qp,0)
-	    //                      +  sqrt(hyperviscosity(cell,qp,0))*htildegradNodes(qp,1)*wGradBF(cell,node,qp,1);
-  	  }
-	}
-      }//end if ncoeff==1
-
       //OG: this is a patch to fix vorticity field Residual(..,..,3)
       //for backward Euler. This adds a nontrivial block to the mass matrix that is stored to compute
       //a hyperviscosity  update for residual, LM^{-1}L. Since L contains zero block for vorticity
@@ -1284,20 +1354,6 @@ evaluateFields(typename Traits::EvalData workset)
 
       get_coriolis(cell, coriolis);
 
-      if ((useExplHyperviscosity)&&(n_coeff == 1)) {
-        //uX.initialize();
-	//uY.initialize();
-	//uZ.initialize();
-	Kokkos::deep_copy(utX,0.0);
-	Kokkos::deep_copy(utY,0.0);
-	Kokkos::deep_copy(utZ,0.0);
-	//uXgradNodes.initialize();
-	//uYgradNodes.initialize();
-	//uZgradNodes.initialize();
-	Kokkos::deep_copy(utXgradNodes,0.0);
-	Kokkos::deep_copy(utYgradNodes,0.0);
-	Kokkos::deep_copy(utZgradNodes,0.0); 
-      }
       if (useImplHyperviscosity) {
 	Kokkos::deep_copy(uX,0.0);
 	Kokkos::deep_copy(uY,0.0);
@@ -1321,35 +1377,9 @@ evaluateFields(typename Traits::EvalData workset)
 	potentialEnergyAtNodes(node) = gravity*depth;
 	uAtNodes(node, 0) = ulambda;
 	uAtNodes(node, 1) = utheta;
-	ScalarT utlambda;
-	ScalarT uttheta;
-	if ((useExplHyperviscosity)&&(n_coeff == 1)) {
-	  utlambda = UDotDotNodal(cell, node,1);
-	  uttheta  = UDotDotNodal(cell, node,2);
-	}
-
-	if (useImplHyperviscosity) {
-	  utlambda = UNodal(cell, node,4);
-	  uttheta  = UNodal(cell, node,5);
-	}
-
-	if ((useExplHyperviscosity)&&(n_coeff == 1)) {
-	  const typename PHAL::Ref<const MeshScalarT>::type lam = lambda_nodal(cell, node),
-	                                                    th = theta_nodal(cell, node);
- 	  const ScalarT	k11 = -sin(lam),
-			k12 = -sin(th)*cos(lam),
-			k21 =  cos(lam),
-			k22 = -sin(th)*sin(lam),
-			k32 =  cos(th);
- 	  //uX(node) = k11*ulambda + k12*utheta;
-	  //uY(node) = k21*ulambda + k22*utheta;
-	  //uZ(node) = k32*utheta;
-  	  utX(node) = k11*utlambda + k12*uttheta;
-	  utY(node) = k21*utlambda + k22*uttheta;
-	  utZ(node) = k32*uttheta;
-	}
-
 	if (useImplHyperviscosity) {
+	  const ScalarT utlambda = UNodal(cell, node,4);
+	  const ScalarT uttheta  = UNodal(cell, node,5);
 	  const typename PHAL::Ref<const MeshScalarT>::type lam = lambda_nodal(cell, node),
 					                     th = theta_nodal(cell, node);
 	  const ScalarT	k11 = -sin(lam),
@@ -1368,16 +1398,6 @@ evaluateFields(typename Traits::EvalData workset)
 	}
       }
 
-      if ((useExplHyperviscosity)&&(n_coeff == 1)) {
-	//gradient(uX, cell, uXgradNodes);
-        //gradient(uY, cell, uYgradNodes);
-	//gradient(uZ, cell, uZgradNodes);
-
-	gradient(utX, cell, utXgradNodes);
-	gradient(utY, cell, utYgradNodes);
-	gradient(utZ, cell, utZgradNodes);
-      }
-
       if (useImplHyperviscosity) {
 	gradient(uX, cell, uXgradNodes);
 	gradient(uY, cell, uYgradNodes);
@@ -1469,61 +1489,6 @@ evaluateFields(typename Traits::EvalData workset)
 	}
       }//end if ImplHV
 
-      if ((useExplHyperviscosity)&&(n_coeff == 1)) {
-        for (std::size_t qp=0; qp < numQPs; ++qp) {
-	  for (std::size_t node=0; node < numNodes; ++node) {
-	    const typename PHAL::Ref<const MeshScalarT>::type lam = sphere_coord(cell, node, 0),
-						               th = sphere_coord(cell, node, 1);
-
-	    //K = -sin L    -sin T cos L
-	    //     cos L    -sin T sin L
-	    //     0         cos T
-	    //K^{-1} = K^T
-	    const ScalarT k11 = -sin(lam),
-			  k12 = -sin(th)*cos(lam),
-			  k21 =  cos(lam),
-			  k22 = -sin(th)*sin(lam),
-			  k32 =  cos(th);
-
-	    //Do not delete:
-	    //Consider
-	    //V - tensor in tensor HV formulation, not hyperviscosity coefficient,
-	    //assume V = [v11 v12; v21 v22] then expressions below, for Residual(cell,node,1)
-	    //would take form
-	    /*     k11*( (v11*utXgradNodes(qp,0) + v12*utXgradNodes(qp,1))*wGradBF(cell,node,qp,0) +
-                   (v21*utXgradNodes(qp,0) + v22*utXgradNodes(qp,1))*wGradBF(cell,node,qp,1)
-                   )
-                 + k21*( (v11*utYgradNodes(qp,0) + v12*utYgradNodes(qp,1))*wGradBF(cell,node,qp,0) +
-                   (v21*utYgradNodes(qp,0) + v22*utYgradNodes(qp,1))*wGradBF(cell,node,qp,1)
-                   )
-	    */
-
-
-	    Residual(cell,node,1) += sHvTau*(
-				     k11*( utXgradNodes(qp,0)*wGradBF(cell,node,qp,0) + utXgradNodes(qp,1)*wGradBF(cell,node,qp,1))
-				   + k21*( utYgradNodes(qp,0)*wGradBF(cell,node,qp,0) + utYgradNodes(qp,1)*wGradBF(cell,node,qp,1))
-				   //k31 = 0
-				   );
- 	    Residual(cell,node,2) += sHvTau*(
-				     k12*( utXgradNodes(qp,0)*wGradBF(cell,node,qp,0) + utXgradNodes(qp,1)*wGradBF(cell,node,qp,1))
-				   + k22*( utYgradNodes(qp,0)*wGradBF(cell,node,qp,0) + utYgradNodes(qp,1)*wGradBF(cell,node,qp,1))
-				   + k32*( utZgradNodes(qp,0)*wGradBF(cell,node,qp,0) + utZgradNodes(qp,1)*wGradBF(cell,node,qp,1))
-				   );
- 	    if(plotVorticity) Residual(cell,node,3) += 0.0;
-	    /*
-            if (doNotDampRotation) {
-              //adding back the first mode (in sph. harmonic basis) which corresponds to -2/R/R eigenvalue of laplace
-
-              Residual(cell,node,1) += -hyperviscosity(cell,qp,0)*2.0*U(cell,qp,4)*RRadius*RRadius*wBF(cell,node,qp);
-              Residual(cell,node,2) += -hyperviscosity(cell,qp,0)*2.0*U(cell,qp,5)*RRadius*RRadius*wBF(cell,node,qp);
-
-              Residual(cell,node,4) += -2.0*U(cell,qp,1)*wBF(cell,node,qp)*RRadius*RRadius;
-
-              Residual(cell,node,5) += -2.0*U(cell,qp,2)*wBF(cell,node,qp)*RRadius*RRadius;
-            } */
-	  }
-	}
-      }//end if ExplHV
     } // end workset cell loop
   } //end if !prescribedVelocities
 
@@ -1616,11 +1581,11 @@ ShallowWaterResid<EvalT,Traits>::divergence(const Kokkos::DynRankView<ScalarT, P
 			jinv10*fieldAtNodes(node, 0)+ jinv11*fieldAtNodes(node, 1) );
   }
 
+  // Sum factorized on tensor-product elements, see Aeras::TensorProductStencil
   for (std::size_t qp=0; qp < numQPs; ++qp) {
-    for (std::size_t node=0; node < numNodes; ++node) {
-      div(qp) += vcontra(node, 0)*grad_at_cub_points(node, qp,0)
-               + vcontra(node, 1)*grad_at_cub_points(node, qp,1);
-    }
+    for (int dir=0; dir < 2; ++dir)
+      for (int k=stencil.begin(qp,dir); k < stencil.end(qp,dir); ++k)
+        div(qp) += vcontra(stencil.node(k), dir)*stencil.weight(k);
   }
 
   for (std::size_t qp=0; qp < numQPs; ++qp) {
@@ -1651,10 +1616,10 @@ ShallowWaterResid<EvalT,Traits>::gradient(const Kokkos::DynRankView<ScalarT, PHX
   for (std::size_t qp=0; qp < numQPs; ++qp) {
     ScalarT gx = 0;
     ScalarT gy = 0;
-    for (std::size_t node=0; node < numNodes; ++node) {
-      gx +=   fieldAtNodes(node)*grad_at_cub_points(node, qp,0);
-      gy +=   fieldAtNodes(node)*grad_at_cub_points(node, qp,1);
-    }
+    for (int k=stencil.begin(qp,0); k < stencil.end(qp,0); ++k)
+      gx += fieldAtNodes(stencil.node(k))*stencil.weight(k);
+    for (int k=stencil.begin(qp,1); k < stencil.end(qp,1); ++k)
+      gy += fieldAtNodes(stencil.node(k))*stencil.weight(k);
     gradField(qp, 0) = jacobian_inv(cell, qp, 0, 0)*gx + jacobian_inv(cell, qp, 1, 0)*gy;
     gradField(qp, 1) = jacobian_inv(cell, qp, 0, 1)*gx + jacobian_inv(cell, qp, 1, 1)*gy;
   }
@@ -1712,10 +1677,10 @@ ShallowWaterResid<EvalT,Traits>::curl(const Kokkos::DynRankView<ScalarT, PHX::De
 
 
   for (std::size_t qp=0; qp < numQPs; ++qp) {
-    for (std::size_t node=0; node < numNodes; ++node) {
-      curl(qp) += covariantVector(node, 1)*grad_at_cub_points(node, qp,0)
-                - covariantVector(node, 0)*grad_at_cub_points(node, qp,1);
-    }
+    for (int k=stencil.begin(qp,0); k < stencil.end(qp,0); ++k)
+      curl(qp) += covariantVector(stencil.node(k), 1)*stencil.weight(k);
+    for (int k=stencil.begin(qp,1); k < stencil.end(qp,1); ++k)
+      curl(qp) -= covariantVector(stencil.node(k), 0)*stencil.weight(k);
     curl(qp) = curl(qp)/jacobian_det(cell,qp);
   }
 
@@ -0,0 +1,258 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef AERAS_TENSORPRODUCTSTENCIL_HPP
+#define AERAS_TENSORPRODUCTSTENCIL_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "Albany_DataTypes.hpp"
+#include "Kokkos_DynRankView.hpp"
+#include "Phalanx_KokkosDeviceTypes.hpp"
+
+#include "Teuchos_RCP.hpp"
+#include <Intrepid2_Basis.hpp>
+#include <Intrepid2_Cubature.hpp>
+
+namespace Aeras {
+
+/* Derivatives of a nodal basis at the cubature points, stored as a stencil.
+ *
+ * On the collocated GLL quadrilaterals built by Aeras::SpectralDiscretization,
+ * the reference derivative of node i at point q vanishes unless i lies on the
+ * coordinate line through q in that direction. A derivative at a point then
+ * needs the np nodes of one line instead of all np^2 nodes of the element,
+ * which is sum factorization of the tensor-product basis: O(p^3) per element
+ * instead of O(p^4). Physical gradients (GradBF) mix both directions and are
+ * supported on the union of the two lines, 2np-1 nodes.
+ *
+ * The stencil is built from the values the basis itself returns, dropping the
+ * entries that vanish, so elements without this structure simply keep every
+ * node and give the same result as the dense loops.
+ *
+ * The stencil lives in PHX::Device views and is copied by value into the
+ * Kokkos functors of the evaluators, so the accessors and the level loops
+ * below are usable on both the host and the device paths. The loops keep the
+ * level index innermost so that, for the level fields of the hydrostatic
+ * evaluators, one stencil weight is applied to a contiguous column of levels.
+ */
+class TensorProductStencil {
+public:
+
+  TensorProductStencil () : numQPs_(0), numDirs_(0) {}
+
+  //! gradAtCubPoints(node, qp, dir): reference gradient of the basis at the cubature points.
+  explicit TensorProductStencil (const Kokkos::DynRankView<RealType, PHX::Device>& gradAtCubPoints) {
+    build(gradAtCubPoints);
+  }
+
+  //! Reference gradient of basis evaluated at the points of cubature.
+  TensorProductStencil (const Teuchos::RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> >& basis,
+                        const Teuchos::RCP<Intrepid2::Cubature<PHX::Device> >& cubature) {
+    const int numNodes = basis->getCardinality();
+    const int numQPs   = cubature->getNumPoints();
+    const int numDirs  = cubature->getDimension();
+    Kokkos::DynRankView<RealType, PHX::Device> refPoints("refPoints", numQPs, numDirs);
+    Kokkos::DynRankView<RealType, PHX::Device> refWeights("refWeights", numQPs);
+    Kokkos::DynRankView<RealType, PHX::Device> gradAtCubPoints("gradAtCubPoints", numNodes, numQPs, numDirs);
+    cubature->getCubature(refPoints, refWeights);
+    basis->getValues(gradAtCubPoints, refPoints, Intrepid2::OPERATOR_GRAD);
+    build(gradAtCubPoints);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  bool empty () const { return numQPs_ == 0; }
+
+  //! Entries [begin(qp,dir), end(qp,dir)) of the reference derivative in direction dir at qp.
+  KOKKOS_INLINE_FUNCTION
+  int begin (int qp, int dir) const { return offsets_(qp*numDirs_ + dir); }
+  KOKKOS_INLINE_FUNCTION
+  int end   (int qp, int dir) const { return offsets_(qp*numDirs_ + dir + 1); }
+  KOKKOS_INLINE_FUNCTION
+  int node   (int k) const { return nodes_(k); }
+  KOKKOS_INLINE_FUNCTION
+  RealType weight (int k) const { return weights_(k); }
+
+  //! Nodes [supportBegin(qp), supportEnd(qp)) whose gradient does not vanish at qp.
+  KOKKOS_INLINE_FUNCTION
+  int supportBegin (int qp) const { return supportOffsets_(qp); }
+  KOKKOS_INLINE_FUNCTION
+  int supportEnd   (int qp) const { return supportOffsets_(qp + 1); }
+  KOKKOS_INLINE_FUNCTION
+  int supportNode  (int k) const { return supportNodes_(k); }
+
+  //! grad(cell,qp,level,dim) = sum_node val(cell,node,level) GradBF(cell,node,qp,dim).
+  template<typename ValT, typename GradBFT, typename GradT>
+  KOKKOS_INLINE_FUNCTION
+  void gradientLevels (const ValT& val, const GradBFT& GradBF, const GradT& grad,
+                       const int cell, const int numLevels, const int numDims) const {
+    for (int qp=0; qp < numQPs_; ++qp) {
+      for (int level=0; level < numLevels; ++level)
+        for (int dim=0; dim < numDims; ++dim)
+          grad(cell,qp,level,dim) = 0;
+      for (int k=supportBegin(qp); k < supportEnd(qp); ++k) {
+        const int node = supportNode(k);
+        for (int dim=0; dim < numDims; ++dim) {
+          const auto gbf = GradBF(cell,node,qp,dim);
+          for (int level=0; level < numLevels; ++level)
+            grad(cell,qp,level,dim) += val(cell,node,level)*gbf;
+        }
+      }
+    }
+  }
+
+  //! div(cell,qp,level) = sum_node sum_dim val(cell,node,level,dim) GradBF(cell,node,qp,dim).
+  template<typename ValT, typename GradBFT, typename DivT>
+  KOKKOS_INLINE_FUNCTION
+  void divergenceLevels (const ValT& val, const GradBFT& GradBF, const DivT& div,
+                         const int cell, const int numLevels, const int numDims) const {
+    for (int qp=0; qp < numQPs_; ++qp) {
+      for (int level=0; level < numLevels; ++level)
+        div(cell,qp,level) = 0;
+      for (int k=supportBegin(qp); k < supportEnd(qp); ++k) {
+        const int node = supportNode(k);
+        for (int dim=0; dim < numDims; ++dim) {
+          const auto gbf = GradBF(cell,node,qp,dim);
+          for (int level=0; level < numLevels; ++level)
+            div(cell,qp,level) += val(cell,node,level,dim)*gbf;
+        }
+      }
+    }
+  }
+
+  //! Weak form of a divergence, the transpose of gradientLevels:
+  //! out(cell,node,level) += sum_qp sum_dim flux(cell,qp,level,dim) wGradBF(cell,node,qp,dim).
+  template<typename FluxT, typename GradBFT, typename OutT>
+  KOKKOS_INLINE_FUNCTION
+  void addWeakDivergenceLevels (const FluxT& flux, const GradBFT& wGradBF, const OutT& out,
+                                const int cell, const int numLevels, const int numDims) const {
+    for (int qp=0; qp < numQPs_; ++qp) {
+      for (int k=supportBegin(qp); k < supportEnd(qp); ++k) {
+        const int node = supportNode(k);
+        for (int dim=0; dim < numDims; ++dim) {
+          const auto wgbf = wGradBF(cell,node,qp,dim);
+          for (int level=0; level < numLevels; ++level)
+            out(cell,node,level) += flux(cell,qp,level,dim)*wgbf;
+        }
+      }
+    }
+  }
+
+  //! Reference divergence of a nodal vector v(node,level,dir) of cell at qp, for all levels:
+  //! out(cell,qp,level) = sum_dir d/dxi_dir v(.,level,dir).
+  template<typename VecT, typename OutT>
+  KOKKOS_INLINE_FUNCTION
+  void refDivergence (const VecT& v, const OutT& out,
+                      const int cell, const int qp, const int numLevels) const {
+    for (int level=0; level < numLevels; ++level)
+      out(cell,qp,level) = 0;
+    for (int dir=0; dir < numDirs_; ++dir) {
+      for (int k=begin(qp,dir); k < end(qp,dir); ++k) {
+        const int n = node(k);
+        const RealType w = weight(k);
+        for (int level=0; level < numLevels; ++level)
+          out(cell,qp,level) += w*v(n,level,dir);
+      }
+    }
+  }
+
+  //! Reference curl of a covariant nodal vector v(node,level,dir) of cell at qp, for all levels:
+  //! out(cell,qp,level) = d/dxi_0 v(.,level,1) - d/dxi_1 v(.,level,0).
+  template<typename VecT, typename OutT>
+  KOKKOS_INLINE_FUNCTION
+  void refCurl (const VecT& v, const OutT& out,
+                const int cell, const int qp, const int numLevels) const {
+    for (int level=0; level < numLevels; ++level)
+      out(cell,qp,level) = 0;
+    for (int k=begin(qp,0); k < end(qp,0); ++k) {
+      const int n = node(k);
+      const RealType w = weight(k);
+      for (int level=0; level < numLevels; ++level)
+        out(cell,qp,level) += w*v(n,level,1);
+    }
+    for (int k=begin(qp,1); k < end(qp,1); ++k) {
+      const int n = node(k);
+      const RealType w = weight(k);
+      for (int level=0; level < numLevels; ++level)
+        out(cell,qp,level) -= w*v(n,level,0);
+    }
+  }
+
+private:
+
+  void build (const Kokkos::DynRankView<RealType, PHX::Device>& gradAtCubPointsDevice) {
+    auto gradAtCubPoints = Kokkos::create_mirror_view(gradAtCubPointsDevice);
+    Kokkos::deep_copy(gradAtCubPoints, gradAtCubPointsDevice);
+
+    const int numNodes = gradAtCubPoints.dimension(0);
+    numQPs_  = gradAtCubPoints.dimension(1);
+    numDirs_ = gradAtCubPoints.dimension(2);
+
+    RealType gmax = 0;
+    for (int node=0; node < numNodes; ++node)
+      for (int qp=0; qp < numQPs_; ++qp)
+        for (int dir=0; dir < numDirs_; ++dir)
+          gmax = std::max(gmax, std::abs(gradAtCubPoints(node, qp, dir)));
+    const RealType tol = 1.0e-12*gmax;
+
+    std::vector<int>      offsets(1, 0), nodes, supportOffsets(1, 0), supportNodes;
+    std::vector<RealType> weights;
+    for (int qp=0; qp < numQPs_; ++qp) {
+      for (int dir=0; dir < numDirs_; ++dir) {
+        for (int node=0; node < numNodes; ++node) {
+          const RealType g = gradAtCubPoints(node, qp, dir);
+          if (std::abs(g) > tol) {
+            nodes.push_back(node);
+            weights.push_back(g);
+          }
+        }
+        offsets.push_back(nodes.size());
+      }
+      for (int node=0; node < numNodes; ++node) {
+        for (int dir=0; dir < numDirs_; ++dir) {
+          if (std::abs(gradAtCubPoints(node, qp, dir)) > tol) {
+            supportNodes.push_back(node);
+            break;
+          }
+        }
+      }
+      supportOffsets.push_back(supportNodes.size());
+    }
+
+    offsets_        = toDevice(offsets, "offsets");
+    nodes_          = toDevice(nodes, "nodes");
+    weights_        = toDevice(weights, "weights");
+    supportOffsets_ = toDevice(supportOffsets, "supportOffsets");
+    supportNodes_   = toDevice(supportNodes, "supportNodes");
+  }
+
+  template<typename T>
+  static Kokkos::View<T*, PHX::Device> toDevice (const std::vector<T>& v, const std::string& name) {
+    Kokkos::View<T*, PHX::Device> result(name, v.size());
+    auto host = Kokkos::create_mirror_view(result);
+    for (std::size_t i=0; i < v.size(); ++i)
+      host(i) = v[i];
+    Kokkos::deep_copy(result, host);
+    return result;
+  }
+
+  int numQPs_;
+  int numDirs_;
+
+  Kokkos::View<int*, PHX::Device>      offsets_;
+  Kokkos::View<int*, PHX::Device>      nodes_;
+  Kokkos::View<RealType*, PHX::Device> weights_;
+
+  Kokkos::View<int*, PHX::Device>      supportOffsets_;
+  Kokkos::View<int*, PHX::Device>      supportNodes_;
+};
+
+} // namespace Aeras
+
+#endif
@@ -58,8 +58,9 @@ postRegistrationSetup(typename Traits::SetupData d,
   refPoints = Kokkos::DynRankView<RealType, PHX::Device>("XXX", numQPs, 2);
   cubature->getCubature(refPoints, refWeights);
   intrepidBasis->getValues(grad_at_cub_points, refPoints, Intrepid2::OPERATOR_GRAD);
+  stencil = TensorProductStencil(grad_at_cub_points);
 
-  vco = Kokkos::createDynRankView(val_node.get_view(), "XXX", numNodes, 2);
+  vco = Kokkos::createDynRankView(val_node.get_view(), "XXX", numNodes, numLevels, 2);
 }
 
 //**********************************************************************
@@ -71,13 +72,14 @@ void VorticityLevels<EvalT, Traits>::
 operator() (const Vorticity_Orig_Tag& tag, const int & cell) const 
 {
   for (int qp=0; qp < numQPs; ++qp) {
-    for (int level=0; level < numLevels; ++level) {
-      ScalarT tmp = 0.0; 
-      for (int node= 0 ; node < numNodes; ++node) { 
-         tmp += (val_node(cell,node,level,1) * GradBF(cell,node,qp,0) 
-             -  val_node(cell,node,level,0) * GradBF(cell,node,qp,1));
-      }
-      vort_val_qp(cell,qp,level) = tmp;
+    for (int level=0; level < numLevels; ++level)
+      vort_val_qp(cell,qp,level) = 0.0;
+    for (int k=stencil.supportBegin(qp); k < stencil.supportEnd(qp); ++k) {
+      const int node = stencil.supportNode(k);
+      const MeshScalarT gbf0 = GradBF(cell,node,qp,0);
+      const MeshScalarT gbf1 = GradBF(cell,node,qp,1);
+      for (int level=0; level < numLevels; ++level)
+        vort_val_qp(cell,qp,level) += val_node(cell,node,level,1)*gbf0 - val_node(cell,node,level,0)*gbf1;
     }
   }
 }
@@ -87,18 +89,22 @@ KOKKOS_INLINE_FUNCTION
 void VorticityLevels<EvalT, Traits>::
 operator() (const Vorticity_Tag& tag, const int & cell) const 
 {
+  // Sum factorized on tensor-product elements, see Aeras::TensorProductStencil.
+  // The covariant components are formed on the fly, only on the stencil nodes.
   for (int level=0; level < numLevels; ++level) {
-    for (std::size_t qp=0; qp < numQPs; ++qp) {
+    for (int qp=0; qp < numQPs; ++qp) {
       ScalarT tmp = 0.0; 
-      for (std::size_t node=0; node < numNodes; ++node) {
-        const MeshScalarT j00 = jacobian(cell, node, 0, 0);
-        const MeshScalarT j01 = jacobian(cell, node, 0, 1);
-        const MeshScalarT j10 = jacobian(cell, node, 1, 0);
-        const MeshScalarT j11 = jacobian(cell, node, 1, 1);
-        ScalarT vco0 = j00*val_node(cell, node, level, 0) + j10*val_node(cell, node, level, 1);
-        ScalarT vco1 = j01*val_node(cell, node, level, 0) + j11*val_node(cell, node, level, 1);
-        tmp += vco1*grad_at_cub_points(node, qp,0)
-             - vco0*grad_at_cub_points(node, qp,1);
+      for (int k=stencil.begin(qp,0); k < stencil.end(qp,0); ++k) {
+        const int node = stencil.node(k);
+        const ScalarT vco1 = jacobian(cell, node, 0, 1)*val_node(cell, node, level, 0)
+                           + jacobian(cell, node, 1, 1)*val_node(cell, node, level, 1);
+        tmp += vco1*stencil.weight(k);
+      }
+      for (int k=stencil.begin(qp,1); k < stencil.end(qp,1); ++k) {
+        const int node = stencil.node(k);
+        const ScalarT vco0 = jacobian(cell, node, 0, 0)*val_node(cell, node, level, 0)
+                           + jacobian(cell, node, 1, 0)*val_node(cell, node, level, 1);
+        tmp -= vco0*stencil.weight(k);
       }
       vort_val_qp(cell,qp,level) = tmp/jacobian_det(cell,qp);
     }
@@ -132,24 +138,23 @@ evaluateFields(typename Traits::EvalData workset)
   }
 #else
   for (int cell=0; cell < workset.numCells; ++cell) {
-    for (int level=0; level < numLevels; ++level) {
-      for (std::size_t node=0; node < numNodes; ++node) {
-	const MeshScalarT j00 = jacobian(cell, node, 0, 0);
-	const MeshScalarT j01 = jacobian(cell, node, 0, 1);
-	const MeshScalarT j10 = jacobian(cell, node, 1, 0);
-	const MeshScalarT j11 = jacobian(cell, node, 1, 1);
-
-	vco(node, 0 ) = j00*val_node(cell, node, level, 0) + j10*val_node(cell, node, level, 1);
-	vco(node, 1 ) = j01*val_node(cell, node, level, 0) + j11*val_node(cell, node, level, 1);
+    for (std::size_t node=0; node < numNodes; ++node) {
+      const MeshScalarT j00 = jacobian(cell, node, 0, 0);
+      const MeshScalarT j01 = jacobian(cell, node, 0, 1);
+      const MeshScalarT j10 = jacobian(cell, node, 1, 0);
+      const MeshScalarT j11 = jacobian(cell, node, 1, 1);
+      for (int level=0; level < numLevels; ++level) {
+	vco(node, level, 0) = j00*val_node(cell, node, level, 0) + j10*val_node(cell, node, level, 1);
+	vco(node, level, 1) = j01*val_node(cell, node, level, 0) + j11*val_node(cell, node, level, 1);
       }
+    }
 
-      for (std::size_t qp=0; qp < numQPs; ++qp) {
-        for (std::size_t node=0; node < numNodes; ++node) {
-	  vort_val_qp(cell,qp,level) += vco(node, 1)*grad_at_cub_points(node, qp,0)
-            	                     - vco(node, 0)*grad_at_cub_points(node, qp,1);
-	}
-	vort_val_qp(cell,qp,level) /= jacobian_det(cell,qp);
-      }
+    // Sum factorized on tensor-product elements, see Aeras::TensorProductStencil
+    for (std::size_t qp=0; qp < numQPs; ++qp) {
+      stencil.refCurl(vco, vort_val_qp, cell, qp, numLevels);
+      const MeshScalarT det_j = jacobian_det(cell,qp);
+      for (int level=0; level < numLevels; ++level)
+	vort_val_qp(cell,qp,level) /= det_j;
     }
   }
 
@@ -13,6 +13,7 @@
 #include "Phalanx_MDField.hpp"
 #include "Aeras_Layouts.hpp"
 #include "Aeras_Dimension.hpp"
+#include "Aeras_TensorProductStencil.hpp"
 #include "Sacado_ParameterAccessor.hpp"
 
 namespace Aeras {
@@ -59,6 +60,11 @@ private:
   // Output:
   PHX::MDField<ScalarT,Cell,Node,Level> Residual;
 
+  //! Optional; if given, the Laplace operator only sums the nodes on the support of wGradBF
+  Teuchos::RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> > intrepidBasis;
+  Teuchos::RCP<Intrepid2::Cubature<PHX::Device> > cubature;
+  TensorProductStencil stencil;
+
   ScalarT Re; // Reynolds number (demo on how to get info from input file)
 
   ScalarT Cp;
@@ -61,6 +61,11 @@ XZHydrostatic_TemperatureResid(const Teuchos::ParameterList& p,
 
   this->addEvaluatedField(Residual);
 
+  if (p.isParameter("Intrepid2 Basis")) {
+    intrepidBasis = p.get<Teuchos::RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> > > ("Intrepid2 Basis");
+    cubature      = p.get<Teuchos::RCP <Intrepid2::Cubature<PHX::Device> > >("Cubature");
+  }
+
   this->setName("Aeras::XZHydrostatic_TemperatureResid" + PHX::typeAsString<EvalT>());
 
   // Register Reynolds number as Sacado-ized Parameter
@@ -89,6 +94,9 @@ postRegistrationSetup(typename Traits::SetupData d,
   this->utils.setFieldData(wGradBF,        fm);
 
   this->utils.setFieldData(Residual,       fm);
+
+  if (intrepidBasis != Teuchos::null)
+    stencil = TensorProductStencil(intrepidBasis, cubature);
 }
 
 //**********************************************************************
@@ -128,6 +136,13 @@ template<typename EvalT, typename Traits>
 KOKKOS_INLINE_FUNCTION
 void XZHydrostatic_TemperatureResid<EvalT, Traits>::
 operator() (const XZHydrostatic_TemperatureResid_Laplace_Tag& tag, const int& cell) const{
+  if (!stencil.empty()) {
+    for (int node=0; node < numNodes; ++node)
+      for (int level=0; level < numLevels; ++level)
+        Residual(cell,node,level) = 0;
+    stencil.addWeakDivergenceLevels(temperatureGrad, wGradBF, Residual, cell, numLevels, numDims);
+    return;
+  }
   for (int node=0; node < numNodes; ++node) {
     for (int level=0; level < numLevels; ++level) {
       Residual(cell,node,level) = 0;
@@ -201,6 +216,11 @@ evaluateFields(typename Traits::EvalData workset)
     }
   }//end of (if not Laplace op)
 
+  else if (!stencil.empty()) {//building Laplace, sum factorized, see Aeras::TensorProductStencil
+    for (int cell=0; cell < workset.numCells; ++cell)
+      stencil.addWeakDivergenceLevels(temperatureGrad, wGradBF, Residual, cell, numLevels, numDims);
+  }
+
   else {//building Laplace
     for (int cell=0; cell < workset.numCells; ++cell) {
       for (int node=0; node < numNodes; ++node) {
@@ -315,6 +315,9 @@ Aeras::HydrostaticProblem::constructEvaluators(
     p->set<string>("Gradient BF Name", "Grad BF");
     p->set<string>("Gradient Variable Name", dof_names_tracers_gradient[t]);
 
+    p->set< RCP<Intrepid2::Cubature<PHX::Device> > >("Cubature", cubature);
+    p->set< RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> > > ("Intrepid2 Basis", intrepidBasis);
+
     ev = rcp(new Aeras::DOFGradInterpolationLevels<EvalT,AlbanyTraits>(*p,dl));
     fm0.template registerEvaluator<EvalT>(ev);
   }
@@ -432,6 +435,9 @@ Aeras::HydrostaticProblem::constructEvaluators(
     p->set<string>("Gradient BF Name", "Grad BF");
     p->set<string>("Gradient Variable Name", dof_names_levels_gradient[1]);
     
+    p->set< RCP<Intrepid2::Cubature<PHX::Device> > >("Cubature", cubature);
+    p->set< RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> > > ("Intrepid2 Basis", intrepidBasis);
+
     ev = rcp(new Aeras::DOFGradInterpolationLevels<EvalT,AlbanyTraits>(*p,dl));
     fm0.template registerEvaluator<EvalT>(ev);
   }
@@ -471,6 +477,9 @@ Aeras::HydrostaticProblem::constructEvaluators(
     p->set<string>("Gradient BF Name", "Grad BF");
     p->set<string>("Gradient Variable Name", "KineticEnergy_gradient");
   
+    p->set< RCP<Intrepid2::Cubature<PHX::Device> > >("Cubature", cubature);
+    p->set< RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> > > ("Intrepid2 Basis", intrepidBasis);
+
     ev = rcp(new Aeras::DOFGradInterpolationLevels<EvalT,AlbanyTraits>(*p,dl));
     fm0.template registerEvaluator<EvalT>(ev);
   }
@@ -496,6 +505,8 @@ Aeras::HydrostaticProblem::constructEvaluators(
     p->set<std::string>("QP Vorticity", "Vorticity_QP");
     p->set<string>("Jacobian Det Name",          "Jacobian Det");
     p->set<string>("Jacobian Name",              "Jacobian");
+    p->set< RCP<Intrepid2::Cubature<PHX::Device> > >("Cubature", cubature);
+    p->set< RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> > > ("Intrepid2 Basis", intrepidBasis);
 
     
     p->set<RCP<ParamLib> >("Parameter Library", paramLib);
@@ -555,6 +566,8 @@ Aeras::HydrostaticProblem::constructEvaluators(
     p->set<std::string>("Velocity",                       "Velocity");
     p->set<std::string>("Omega",                          "Omega");
     p->set<std::string>("EtaDotdT",                       "EtaDotdT");
+    p->set< RCP<Intrepid2::Cubature<PHX::Device> > >("Cubature", cubature);
+    p->set< RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> > > ("Intrepid2 Basis", intrepidBasis);
     
     p->set<RCP<ParamLib> >("Parameter Library", paramLib);
     Teuchos::ParameterList& paramList = params->sublist("Hydrostatic Problem");
@@ -599,6 +612,9 @@ Aeras::HydrostaticProblem::constructEvaluators(
       p->set<string>("Gradient BF Name"    ,   "Grad BF");
       p->set<string>("Gradient Variable Name",   "Gradient QP Pressure");
     
+      p->set< RCP<Intrepid2::Cubature<PHX::Device> > >("Cubature", cubature);
+      p->set< RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> > > ("Intrepid2 Basis", intrepidBasis);
+
       ev = rcp(new Aeras::DOFGradInterpolationLevels<EvalT,AlbanyTraits>(*p,dl));
       fm0.template registerEvaluator<EvalT>(ev);
   }
@@ -749,6 +765,9 @@ Aeras::HydrostaticProblem::constructEvaluators(
       p->set<string>("Gradient BF Name",       "Grad BF");
       p->set<string>("Gradient Variable Name", "Gradient QP GeoPotential");
     
+      p->set< RCP<Intrepid2::Cubature<PHX::Device> > >("Cubature", cubature);
+      p->set< RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> > > ("Intrepid2 Basis", intrepidBasis);
+
       ev = rcp(new Aeras::DOFGradInterpolationLevels<EvalT,AlbanyTraits>(*p,dl));
       fm0.template registerEvaluator<EvalT>(ev);
   }
@@ -870,6 +889,9 @@ Aeras::HydrostaticProblem::constructEvaluators(
       p->set<string>("Gradient BF Name", "Grad BF");
       p->set<string>("Gradient Variable Name", dof_names_tracers_gradient[t]);
     
+      p->set< RCP<Intrepid2::Cubature<PHX::Device> > >("Cubature", cubature);
+      p->set< RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> > > ("Intrepid2 Basis", intrepidBasis);
+
       ev = rcp(new Aeras::DOFGradInterpolationLevels<EvalT,AlbanyTraits>(*p,dl));
       fm0.template registerEvaluator<EvalT>(ev);
     }
@@ -108,7 +108,8 @@ Aeras::ShallowWaterProblem::getValidProblemParameters() const
   Teuchos::RCP<Teuchos::ParameterList> validPL =
     this->getGenericProblemParams("ValidShallowWaterProblemParams");
 
-  validPL->sublist("Shallow Water Problem", false, "");
+  validPL->sublist("Shallow Water Problem", false, "").set<bool>("Matrix-Free Hyperviscosity", false,
+      "Explicit hyperviscosity: apply the Laplacian element by element instead of assembling the mass and Laplace matrices");
   validPL->sublist("Aeras Surface Height", false, "");
   validPL->sublist("Aeras Shallow Water Source", false, "");
   validPL->sublist("Equation Set", false, "");
@@ -0,0 +1,210 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+#include "Aeras_TensorProductStencil.hpp"
+
+#include "Intrepid2_DefaultCubatureFactory.hpp"
+#include "Intrepid2_HGRAD_QUAD_Cn_FEM.hpp"
+#include "Kokkos_Core.hpp"
+#include "Shards_CellTopology.hpp"
+
+#include "Teuchos_GlobalMPISession.hpp"
+#include "Teuchos_UnitTestHarness.hpp"
+#include "Teuchos_UnitTestRepository.hpp"
+
+#include <cmath>
+
+namespace {
+
+typedef Kokkos::DynRankView<RealType, PHX::Device> View;
+
+const int numCells  = 3;
+const int numLevels = 4;
+const int numDims   = 2;
+
+// Every operator of the stencil, applied to one cell at a time on the device
+struct ApplyStencil {
+  Aeras::TensorProductStencil stencil;
+  View scalar, vector, refVector, GradBF, flux;
+  View grad, div, weakDiv, refDiv, refCurl;
+  int numQPs;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const int cell) const {
+    stencil.gradientLevels(scalar, GradBF, grad, cell, numLevels, numDims);
+    stencil.divergenceLevels(vector, GradBF, div, cell, numLevels, numDims);
+    stencil.addWeakDivergenceLevels(flux, GradBF, weakDiv, cell, numLevels, numDims);
+    for (int qp=0; qp < numQPs; ++qp) {
+      stencil.refDivergence(refVector, refDiv, cell, qp, numLevels);
+      stencil.refCurl(refVector, refCurl, cell, qp, numLevels);
+    }
+  }
+};
+
+View referenceGradient (const Intrepid2::Basis<PHX::Device, RealType, RealType>& basis, const View& points)
+{
+  View grad("grad", basis.getCardinality(), points.dimension(0), numDims);
+  basis.getValues(grad, points, Intrepid2::OPERATOR_GRAD);
+  return grad;
+}
+
+// Deterministic, non-polynomial nodal data
+RealType sample (const int i, const int j, const int k, const int l)
+{
+  return std::sin(1.0 + i + 0.7*j + 0.3*k + 0.11*l);
+}
+
+// Runs the stencil on the device and checks each operator against the dense loops.
+void compareWithDense (const View& refGrad, Teuchos::FancyOStream& out, bool& success)
+{
+  const int numNodes = refGrad.dimension(0);
+  const int numQPs   = refGrad.dimension(1);
+
+  auto g = Kokkos::create_mirror_view(refGrad);
+  Kokkos::deep_copy(g, refGrad);
+
+  ApplyStencil f;
+  f.stencil   = Aeras::TensorProductStencil(refGrad);
+  f.numQPs    = numQPs;
+  f.scalar    = View("scalar", numCells, numNodes, numLevels);
+  f.vector    = View("vector", numCells, numNodes, numLevels, numDims);
+  f.refVector = View("refVector", numNodes, numLevels, numDims);
+  f.GradBF    = View("GradBF", numCells, numNodes, numQPs, numDims);
+  f.flux      = View("flux", numCells, numQPs, numLevels, numDims);
+  f.grad      = View("grad", numCells, numQPs, numLevels, numDims);
+  f.div       = View("div", numCells, numQPs, numLevels);
+  f.weakDiv   = View("weakDiv", numCells, numNodes, numLevels);
+  f.refDiv    = View("refDiv", numCells, numQPs, numLevels);
+  f.refCurl   = View("refCurl", numCells, numQPs, numLevels);
+
+  auto scalar    = Kokkos::create_mirror_view(f.scalar);
+  auto vector    = Kokkos::create_mirror_view(f.vector);
+  auto refVector = Kokkos::create_mirror_view(f.refVector);
+  auto GradBF    = Kokkos::create_mirror_view(f.GradBF);
+  auto flux      = Kokkos::create_mirror_view(f.flux);
+
+  // GradBF from a different affine map per cell, as ComputeBasisFunctions would give
+  for (int cell=0; cell < numCells; ++cell) {
+    const RealType jinv[2][2] = {{1.0 + 0.1*cell, 0.3}, {-0.2*cell, 0.8}};
+    for (int node=0; node < numNodes; ++node) {
+      for (int level=0; level < numLevels; ++level) {
+        scalar(cell,node,level) = sample(cell,node,level,0);
+        for (int dim=0; dim < numDims; ++dim)
+          vector(cell,node,level,dim) = sample(cell,node,level,dim+1);
+      }
+      for (int qp=0; qp < numQPs; ++qp)
+        for (int dim=0; dim < numDims; ++dim)
+          GradBF(cell,node,qp,dim) = jinv[0][dim]*g(node,qp,0) + jinv[1][dim]*g(node,qp,1);
+    }
+    for (int qp=0; qp < numQPs; ++qp)
+      for (int level=0; level < numLevels; ++level)
+        for (int dim=0; dim < numDims; ++dim)
+          flux(cell,qp,level,dim) = sample(cell,qp,level,dim+3);
+  }
+  for (int node=0; node < numNodes; ++node)
+    for (int level=0; level < numLevels; ++level)
+      for (int dim=0; dim < numDims; ++dim)
+        refVector(node,level,dim) = sample(0,node,level,dim+5);
+
+  Kokkos::deep_copy(f.scalar, scalar);
+  Kokkos::deep_copy(f.vector, vector);
+  Kokkos::deep_copy(f.refVector, refVector);
+  Kokkos::deep_copy(f.GradBF, GradBF);
+  Kokkos::deep_copy(f.flux, flux);
+
+  Kokkos::parallel_for(Kokkos::RangePolicy<PHX::Device::execution_space>(0, numCells), f);
+
+  auto grad    = Kokkos::create_mirror_view(f.grad);
+  auto div     = Kokkos::create_mirror_view(f.div);
+  auto weakDiv = Kokkos::create_mirror_view(f.weakDiv);
+  auto refDiv  = Kokkos::create_mirror_view(f.refDiv);
+  auto refCurl = Kokkos::create_mirror_view(f.refCurl);
+  Kokkos::deep_copy(grad, f.grad);
+  Kokkos::deep_copy(div, f.div);
+  Kokkos::deep_copy(weakDiv, f.weakDiv);
+  Kokkos::deep_copy(refDiv, f.refDiv);
+  Kokkos::deep_copy(refCurl, f.refCurl);
+
+  const RealType tol = 1.0e-12;
+  for (int cell=0; cell < numCells; ++cell) {
+    for (int level=0; level < numLevels; ++level) {
+      for (int qp=0; qp < numQPs; ++qp) {
+        RealType denseDiv = 0, denseRefDiv = 0, denseRefCurl = 0;
+        for (int dim=0; dim < numDims; ++dim) {
+          RealType denseGrad = 0;
+          for (int node=0; node < numNodes; ++node) {
+            denseGrad += scalar(cell,node,level)*GradBF(cell,node,qp,dim);
+            denseDiv  += vector(cell,node,level,dim)*GradBF(cell,node,qp,dim);
+            denseRefDiv += refVector(node,level,dim)*g(node,qp,dim);
+          }
+          TEST_FLOATING_EQUALITY(grad(cell,qp,level,dim), denseGrad, tol);
+        }
+        for (int node=0; node < numNodes; ++node)
+          denseRefCurl += refVector(node,level,1)*g(node,qp,0) - refVector(node,level,0)*g(node,qp,1);
+        TEST_FLOATING_EQUALITY(div(cell,qp,level), denseDiv, tol);
+        TEST_FLOATING_EQUALITY(refDiv(cell,qp,level), denseRefDiv, tol);
+        TEST_FLOATING_EQUALITY(refCurl(cell,qp,level), denseRefCurl, tol);
+      }
+      for (int node=0; node < numNodes; ++node) {
+        RealType denseWeakDiv = 0;
+        for (int qp=0; qp < numQPs; ++qp)
+          for (int dim=0; dim < numDims; ++dim)
+            denseWeakDiv += flux(cell,qp,level,dim)*GradBF(cell,node,qp,dim);
+        TEST_FLOATING_EQUALITY(weakDiv(cell,node,level), denseWeakDiv, tol);
+      }
+    }
+  }
+}
+
+TEUCHOS_UNIT_TEST(Aeras_TensorProductStencil, SpectralQuadIsSumFactorized)
+{
+  // Collocated GLL points, as on the elements of Aeras::SpectralDiscretization
+  const int np = 5;
+  Intrepid2::Basis_HGRAD_QUAD_Cn_FEM<PHX::Device> basis(np-1, Intrepid2::POINTTYPE_WARPBLEND);
+  View points("points", basis.getCardinality(), numDims);
+  basis.getDofCoords(points);
+
+  // At most one line of np nodes per direction (fewer where a derivative
+  // vanishes at its own node, e.g. the middle node of an odd np)
+  const Aeras::TensorProductStencil stencil(referenceGradient(basis, points));
+  for (int qp=0; qp < np*np; ++qp) {
+    TEST_ASSERT(stencil.end(qp,0) - stencil.begin(qp,0) <= np);
+    TEST_ASSERT(stencil.end(qp,1) - stencil.begin(qp,1) <= np);
+    TEST_ASSERT(stencil.supportEnd(qp) - stencil.supportBegin(qp) <= 2*np - 1);
+  }
+
+  compareWithDense(referenceGradient(basis, points), out, success);
+}
+
+TEUCHOS_UNIT_TEST(Aeras_TensorProductStencil, GaussPointsKeepEveryNode)
+{
+  // Off the nodes, every basis function has a nonzero gradient and the stencil is dense
+  const int np = 4;
+  Intrepid2::Basis_HGRAD_QUAD_Cn_FEM<PHX::Device> basis(np-1, Intrepid2::POINTTYPE_WARPBLEND);
+  const shards::CellTopology quad(shards::getCellTopologyData<shards::Quadrilateral<4> >());
+  Intrepid2::DefaultCubatureFactory cubFactory;
+  const Teuchos::RCP<Intrepid2::Cubature<PHX::Device> > cubature =
+    cubFactory.create<PHX::Device, RealType, RealType>(quad, 2*np);
+  View points("points", cubature->getNumPoints(), numDims);
+  View weights("weights", cubature->getNumPoints());
+  cubature->getCubature(points, weights);
+
+  const Aeras::TensorProductStencil stencil(referenceGradient(basis, points));
+  for (int qp=0; qp < cubature->getNumPoints(); ++qp)
+    TEST_EQUALITY(stencil.supportEnd(qp) - stencil.supportBegin(qp), basis.getCardinality());
+
+  compareWithDense(referenceGradient(basis, points), out, success);
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+  Teuchos::GlobalMPISession mpiSession(&argc, &argv);
+  Kokkos::initialize(argc, argv);
+  const int result = Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+  Kokkos::finalize();
+  return result;
+}
@@ -25,6 +25,7 @@
 #endif
 
 #include<string>
+#include <algorithm>
 #include "Albany_DataTypes.hpp"
 
 #include "Albany_DummyParameterAccessor.hpp"
@@ -51,6 +52,7 @@
 
 #include "Albany_ScalarResponseFunction.hpp"
 #include "PHAL_Utilities.hpp"
+#include "PHAL_ProfiledEvaluator.hpp"
 
 #ifdef ALBANY_PERIDIGM
 #if defined(ALBANY_EPETRA)
@@ -99,7 +101,9 @@ Application(const RCP<const Teuchos_Comm>& comm_,
     requires_sdbcs_(false), 
     requires_orig_dbcs_(false),
     no_dir_bcs_(false),
-    loca_sdbcs_valid_nonlin_solver_(true) 
+    loca_sdbcs_valid_nonlin_solver_(true),
+    numWorksetThreads(1),
+    wsColorsMeshVersion(-1)
 {
 #if defined(ALBANY_EPETRA)
   comm = Albany::createEpetraCommFromTeuchosComm(comm_);
@@ -131,7 +135,9 @@ Application(const RCP<const Teuchos_Comm>& comm_) :
     requires_sdbcs_(false), 
     no_dir_bcs_(false),
     loca_sdbcs_valid_nonlin_solver_(true), 
-    requires_orig_dbcs_(false)
+    requires_orig_dbcs_(false),
+    numWorksetThreads(1),
+    wsColorsMeshVersion(-1)
 {
 #if defined(ALBANY_EPETRA)
   comm = Albany::createEpetraCommFromTeuchosComm(comm_);
@@ -702,6 +708,11 @@ void Albany::Application::buildProblem()
   problem->setApplication(Teuchos::rcp(this, false));
 #endif //ALBANY_LCM
 
+  // Evaluators built from here on are wrapped for profiling
+  if (problemParams->get("Profile Evaluators", false))
+    PHAL::EvaluatorProfiler::instance().enable(
+        problemParams->get<std::string>("Evaluator Profile Format", "Table"));
+
   problem->buildProblem(meshSpecs, stateMgr);
 
   if ((problem->useSDBCs() == true) && (loca_sdbcs_valid_nonlin_solver_ == false))
@@ -730,6 +741,34 @@ void Albany::Application::buildProblem()
   neq = problem->numEquations();
   spatial_dimension = problem->spatialDimension();
 
+  // Threaded workset evaluation needs one set of volume evaluators per
+  // thread. They have to be built before the state arrays are allocated.
+  numWorksetThreads = problemParams->get("Workset Threads", 1);
+  TEUCHOS_TEST_FOR_EXCEPTION(numWorksetThreads < 1, std::logic_error,
+      "Error in Albany::Application: Workset Threads must be >= 1.\n");
+  checkWorksetThreadsSupported(numWorksetThreads);
+  threadFm.resize(numWorksetThreads - 1);
+  for (int t = 0; t < threadFm.size(); t++) {
+    threadFm[t].resize(meshSpecs.size());
+    for (int ps = 0; ps < meshSpecs.size(); ps++) {
+      threadFm[t][ps] = Teuchos::rcp(new PHX::FieldManager<PHAL::AlbanyTraits>);
+      problem->buildEvaluators(*threadFm[t][ps], *meshSpecs[ps], stateMgr,
+          BUILD_RESID_FM, Teuchos::null);
+    }
+  }
+  if (numWorksetThreads > 1)
+    *out << "Evaluating worksets on " << numWorksetThreads << " threads"
+         << std::endl;
+
+  const int scratchSize = problemParams->get("Workset Scratch Size", 0);
+  TEUCHOS_TEST_FOR_EXCEPTION(scratchSize < 0, std::logic_error,
+      "Error in Albany::Application: Workset Scratch Size must be >= 0.\n");
+  if (scratchSize > 0) {
+    wsScratch.resize(numWorksetThreads);
+    for (int t = 0; t < numWorksetThreads; t++)
+      wsScratch[t] = Teuchos::rcp(new PHAL::WorksetScratch(scratchSize));
+  }
+
   // Construct responses
   // This really needs to happen after the discretization is created for
   // distributed responses, but currently it can't be moved because there
@@ -804,6 +843,15 @@ void Albany::Application::finalSetUp(
   if (!stateMgr.areStateVarsAllocated())
     stateMgr.setStateArrays(disc);
 
+  if (problemParams->get("Cache Basis Functions", false)) {
+    if (disc->getMeshVersion() < 0)
+      *out << "Warning: the discretization does not track mesh changes; "
+           << "basis functions are not cached" << std::endl;
+    else
+      geometryCache = Teuchos::rcp(new PHAL::GeometryCache(
+          problemParams->get("Cache Reference Basis Functions Only", false)));
+  }
+
 #if defined(ALBANY_EPETRA)
   if(!TpetraBuild) {
     RCP<Epetra_Vector> initial_guessE;
@@ -1385,6 +1433,65 @@ void checkDerivatives(Albany::Application& app, const double time,
 }
 } // namespace
 
+template <typename EvalT, typename Setup>
+void Albany::Application::evaluateWorksetsThreaded(
+    PHAL::Workset const& workset,
+    Setup const& setup)
+{
+  const auto& wsElNodeEqID = disc->getWsElNodeEqID();
+  const auto& wsPhysIndex = disc->getWsPhysIndex();
+
+  int const numWorksets = wsElNodeEqID.size();
+
+  // The coloring only changes with the mesh; a negative version means the
+  // discretization does not track it.
+  int const meshVersion = disc->getMeshVersion();
+  if (wsColors.size() == 0 || meshVersion < 0 ||
+      meshVersion != wsColorsMeshVersion) {
+    colorWorksets(wsElNodeEqID, wsColors);
+    wsColorsMeshVersion = meshVersion;
+  }
+
+  Teuchos::Array<PHAL::Workset> thread_worksets(numWorksetThreads, workset);
+  if (wsScratch.size() > 0)
+    for (int t = 0; t < numWorksetThreads; ++t)
+      thread_worksets[t].scratch = wsScratch[t];
+
+  // Worksets within a color do not share rows of the overlapped residual and
+  // Jacobian, so their scatters can run concurrently. They are taken
+  // numWorksetThreads at a time; loading a workset copies RCPs shared by all
+  // threads, so that is done here before the threads start.
+  for (int color = 0; color < wsColors.size(); ++color) {
+    Teuchos::Array<int> const& colorWs = wsColors[color];
+    for (int first = 0; first < colorWs.size(); first += numWorksetThreads) {
+      int const numThreads =
+          std::min<int>(numWorksetThreads, colorWs.size() - first);
+      for (int t = 0; t < numThreads; ++t)
+        setup(thread_worksets[t], colorWs[first + t]);
+      parallelForThreads(numThreads, [&](int const thread) {
+        int const ws = colorWs[first + thread];
+        PHX::FieldManager<PHAL::AlbanyTraits>& thread_fm = thread == 0 ?
+            *fm[wsPhysIndex[ws]] : *threadFm[thread - 1][wsPhysIndex[ws]];
+        thread_fm.template evaluateFields<EvalT>(thread_worksets[thread]);
+      });
+    }
+  }
+
+  // There is a single set of Neumann field managers; apply them serially.
+  if (Teuchos::nonnull(nfm)) {
+    PHAL::Workset nfm_workset = workset;
+    for (int ws = 0; ws < numWorksets; ws++) {
+      setup(nfm_workset, ws);
+#ifdef ALBANY_PERIDIGM
+      // See the serial loop in computeGlobalResidualImplT
+      if (nfm_workset.sideSets->size() == 0) continue;
+#endif
+      deref_nfm(nfm, wsPhysIndex, ws)
+          ->template evaluateFields<EvalT>(nfm_workset);
+    }
+  }
+}
+
 void
 Albany::Application::
 computeGlobalResidualImplT(
@@ -1453,6 +1560,7 @@ computeGlobalResidualImplT(
     }
     *out << std::endl;
     meshMover->moveMesh(shapeParams, morphFromInit);
+    disc->coordinatesChanged();
     coords = disc->getCoords();
     shapeParamsHaveBeenReset = false;
   }
@@ -1490,6 +1598,13 @@ computeGlobalResidualImplT(
 
     workset.fT = overlapped_fT;
 
+    if (numWorksetThreads > 1) {
+      evaluateWorksetsThreaded<PHAL::AlbanyTraits::Residual>(workset,
+          [this](PHAL::Workset& ws_workset, int const ws) {
+            loadWorksetBucketInfo<PHAL::AlbanyTraits::Residual>(ws_workset, ws);
+          });
+    }
+    else
     for (int ws = 0; ws < numWorksets; ws++) {
       loadWorksetBucketInfo<PHAL::AlbanyTraits::Residual>(workset, ws);
 
@@ -1886,6 +2001,71 @@ computeGlobalResidualT(
 }
 #endif // ALBANY_LCM
 
+void
+Albany::Application::
+computeGlobalLaplaceT(
+    const double current_time,
+    const Tpetra_Vector* xdotT,
+    const Tpetra_Vector& xdotdotT,
+    const Tpetra_Vector& xT,
+    const Teuchos::Array<ParamVec>& p,
+    Tpetra_Vector& fT)
+{
+  TEUCHOS_FUNC_TIME_MONITOR("> Albany Fill: Laplace");
+  postRegSetup("Residual");
+
+  const auto& wsPhysIndex = disc->getWsPhysIndex();
+  const int numWorksets = disc->getWsElNodeEqID().size();
+
+  const Teuchos::RCP<Tpetra_Vector> overlapped_fT = solMgrT->get_overlapped_fT();
+  const Teuchos::RCP<Tpetra_Export> exporterT = solMgrT->get_exporterT();
+
+  // Scatter x, xdot and the direction in xdotdot to the overlapped distribution
+  solMgrT->scatterXT(xT, xdotT, &xdotdotT);
+
+  // Set parameters
+  for (int i = 0; i < p.size(); i++) {
+    for (unsigned int j = 0; j < p[i].size(); j++) {
+      p[i][j].family->setRealValueForAllTypes(p[i][j].baseValue);
+    }
+  }
+
+  overlapped_fT->putScalar(0.0);
+  fT.putScalar(0.0);
+
+  {
+    PHAL::Workset workset;
+
+    if (!paramLib->isParameter("Time")) {
+      loadBasicWorksetInfoT(workset, current_time);
+    }
+    else {
+      loadBasicWorksetInfoT(workset,
+          paramLib->getRealValue<PHAL::AlbanyTraits::Residual>("Time"));
+    }
+
+    workset.fT = overlapped_fT;
+    workset.m_coeff = 0.0;
+    workset.j_coeff = 0.0;
+    workset.n_coeff = 1.0;
+
+    if (numWorksetThreads > 1) {
+      evaluateWorksetsThreaded<PHAL::AlbanyTraits::Residual>(workset,
+          [this](PHAL::Workset& ws_workset, int const ws) {
+            loadWorksetBucketInfo<PHAL::AlbanyTraits::Residual>(ws_workset, ws);
+          });
+    }
+    else
+    for (int ws = 0; ws < numWorksets; ws++) {
+      loadWorksetBucketInfo<PHAL::AlbanyTraits::Residual>(workset, ws);
+      fm[wsPhysIndex[ws]]->evaluateFields<PHAL::AlbanyTraits::Residual>(
+          workset);
+    }
+  }
+
+  fT.doExport(*overlapped_fT, *exporterT, Tpetra::ADD);
+}
+
 #if defined(ALBANY_EPETRA)
 double
 Albany::Application::
@@ -1915,7 +2095,8 @@ computeGlobalJacobianImplT(const double alpha,
     const Teuchos::RCP<const Tpetra_Vector>& xT,
     const Teuchos::Array<ParamVec>& p,
     const Teuchos::RCP<Tpetra_Vector>& fT,
-    const Teuchos::RCP<Tpetra_CrsMatrix>& jacT)
+    const Teuchos::RCP<Tpetra_CrsMatrix>& jacT,
+    const bool diagonalOnly)
 {
   TEUCHOS_FUNC_TIME_MONITOR("> Albany Fill: Jacobian");
 
@@ -1936,8 +2117,8 @@ computeGlobalJacobianImplT(const double alpha,
   } else {
     overlapped_fT = Teuchos::null;
   }
-  Teuchos::RCP<Tpetra_CrsMatrix> overlapped_jacT =
-      solMgrT->get_overlapped_jacT();
+  Teuchos::RCP<Tpetra_CrsMatrix> overlapped_jacT = diagonalOnly ?
+      overlappedJacDiagT_ : solMgrT->get_overlapped_jacT();
   Teuchos::RCP<Tpetra_Export> exporterT = solMgrT->get_exporterT();
 
   // Scatter x and xdot to the overlapped distribution
@@ -1959,6 +2140,7 @@ computeGlobalJacobianImplT(const double alpha,
     for (unsigned int i=0; i<shapeParams.size(); i++) *out << shapeParams[i] << "  ";
     *out << std::endl;
     meshMover->moveMesh(shapeParams, morphFromInit);
+    disc->coordinatesChanged();
     coords = disc->getCoords();
     shapeParamsHaveBeenReset = false;
   }
@@ -1980,14 +2162,20 @@ computeGlobalJacobianImplT(const double alpha,
 #endif
   overlapped_jacT->setAllToScalar(0.0);
 #ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
-  if (overlapped_jacT->isFillActive()) {
-    // Makes getLocalMatrix() valid.
-    overlapped_jacT->fillComplete();
-  }
-  if ( ! overlapped_jacT->isFillActive())
-  overlapped_jacT->resumeFill();
-
+  const bool scatterIntoLocalMatrix = true;
+#else
+  // Scatters using precomputed Jacobian offsets write into the local matrix
+  const bool scatterIntoLocalMatrix =
+      !diagonalOnly && disc->getWsJacobianOffsets().size() > 0;
 #endif
+  if (scatterIntoLocalMatrix) {
+    if (overlapped_jacT->isFillActive()) {
+      // Makes getLocalMatrix() valid.
+      overlapped_jacT->fillComplete();
+    }
+    if ( ! overlapped_jacT->isFillActive())
+    overlapped_jacT->resumeFill();
+  }
 
   // Set data in Workset struct, and perform fill via field manager
   {
@@ -2007,6 +2195,7 @@ computeGlobalJacobianImplT(const double alpha,
 
     workset.fT = overlapped_fT;
     workset.JacT = overlapped_jacT;
+    workset.jacobian_diagonal_only = diagonalOnly;
     loadWorksetJacobianInfo(workset, alpha, beta, omega);
 
     //fill Jacobian derivative dimensions:
@@ -2018,6 +2207,13 @@ computeGlobalJacobianImplT(const double alpha,
               explicit_scheme));
     }
 
+    if (numWorksetThreads > 1) {
+      evaluateWorksetsThreaded<PHAL::AlbanyTraits::Jacobian>(workset,
+          [this](PHAL::Workset& ws_workset, int const ws) {
+            loadWorksetBucketInfo<PHAL::AlbanyTraits::Jacobian>(ws_workset, ws);
+          });
+    }
+    else
     for (int ws = 0; ws < numWorksets; ws++) {
       loadWorksetBucketInfo<PHAL::AlbanyTraits::Jacobian>(workset, ws);
       // FillType template argument used to specialize Sacado
@@ -2041,7 +2237,7 @@ computeGlobalJacobianImplT(const double alpha,
   {
     TEUCHOS_FUNC_TIME_MONITOR("> Albany Fill: Jacobian Export");
     //Allocate and populate scaleVec_
-    if (scale != 1.0) {
+    if (!diagonalOnly && scale != 1.0) {
       if (scaleVec_ == Teuchos::null ||
           scaleVec_->getGlobalLength() != jacT->getGlobalNumCols()) {
         scaleVec_ = Teuchos::rcp(new Tpetra_Vector(jacT->getRowMap()));
@@ -2065,7 +2261,7 @@ computeGlobalJacobianImplT(const double alpha,
 #endif
 
     //scale Jacobian
-    if (scaleBCdofs == false && scale != 1.0) {
+    if (!diagonalOnly && scaleBCdofs == false && scale != 1.0) {
       jacT->fillComplete();
 #ifdef WRITE_TO_MATRIX_MARKET
       char nameJacUnscaled[100];  //create string for file name
@@ -2125,7 +2321,7 @@ computeGlobalJacobianImplT(const double alpha,
 
     loadWorksetNodesetInfo(workset);
 
-    if (scaleBCdofs == true) {
+    if (!diagonalOnly && scaleBCdofs == true) {
       setScaleBCDofs(workset);
 #ifdef WRITE_TO_MATRIX_MARKET
       if (countScale == 0)
@@ -2154,7 +2350,7 @@ computeGlobalJacobianImplT(const double alpha,
   jacT->fillComplete();
 
   //Apply scaling to residual and Jacobian
-  if (scaleBCdofs == true) {
+  if (!diagonalOnly && scaleBCdofs == true) {
     if (Teuchos::nonnull(fT))
       fT->elementWiseMultiply(1.0, *scaleVec_, *fT, 0.0);
     jacT->leftScale(*scaleVec_);
@@ -2166,7 +2362,7 @@ computeGlobalJacobianImplT(const double alpha,
     overlapped_jacT->fillComplete();
   }
 #endif
-  if (derivatives_check_ > 0)
+  if (!diagonalOnly && derivatives_check_ > 0)
     checkDerivatives(*this, current_time, xdotT, xdotdotT, xT, p, fT, jacT,
         derivatives_check_);
 }
@@ -2352,6 +2548,59 @@ computeGlobalJacobianT(
   }
 }
 
+namespace {
+// Matrix whose graph holds only the diagonal; the column map is the row map,
+// so local row and column indices coincide as in the overlapped Jacobian
+Teuchos::RCP<Tpetra_CrsMatrix>
+createDiagonalMatrixT(const Teuchos::RCP<const Tpetra_Map>& mapT)
+{
+  const Teuchos::RCP<Tpetra_CrsGraph> graphT = Teuchos::rcp(
+      new Tpetra_CrsGraph(mapT, mapT, 1, Tpetra::StaticProfile));
+  const LO numRows = mapT->getNodeNumElements();
+  for (LO row = 0; row < numRows; ++row)
+    graphT->insertLocalIndices(row, Teuchos::arrayView(&row, 1));
+  graphT->fillComplete();
+  return Teuchos::rcp(new Tpetra_CrsMatrix(graphT));
+}
+}
+
+void
+Albany::Application::
+computeGlobalJacobianDiagonalT(
+    const double alpha,
+    const double beta,
+    const double omega,
+    const double current_time,
+    const Tpetra_Vector* xdotT,
+    const Tpetra_Vector* xdotdotT,
+    const Tpetra_Vector& xT,
+    const Teuchos::Array<ParamVec>& p,
+    Tpetra_Vector& diagT)
+{
+  // Rebuilt after adaptation changes the maps
+  if (Teuchos::is_null(jacDiagT_) ||
+      jacDiagT_->getRowMap() != disc->getMapT() ||
+      overlappedJacDiagT_->getRowMap() != disc->getOverlapMapT()) {
+    jacDiagT_ = createDiagonalMatrixT(disc->getMapT());
+    overlappedJacDiagT_ = createDiagonalMatrixT(disc->getOverlapMapT());
+  }
+
+  this->computeGlobalJacobianImplT(
+      alpha,
+      beta,
+      omega,
+      current_time,
+      Teuchos::rcp(xdotT, false),
+      Teuchos::rcp(xdotdotT, false),
+      Teuchos::rcpFromRef(xT),
+      p,
+      Teuchos::null,
+      jacDiagT_,
+      true);
+
+  jacDiagT_->getLocalDiagCopy(diagT);
+}
+
 void
 Albany::Application::
 computeGlobalPreconditionerT(const RCP<Tpetra_CrsMatrix>& jac,
@@ -2622,6 +2871,7 @@ computeGlobalTangentImplT(
       for (unsigned int ii=0; ii<shapeParams.size(); ii++) *out << shapeParams[ii] << "  ";
       *out << std::endl;
       meshMover->moveMesh(shapeParams, morphFromInit);
+      disc->coordinatesChanged();
       for (int ws=0; ws<coords.size(); ws++) {  //worset
         ws_coord_derivs[ws][i].resize(coords[ws].size());
         for (int e=0; e<coords[ws].size(); e++) { //cell
@@ -2638,6 +2888,7 @@ computeGlobalTangentImplT(
   for (unsigned int i=0; i<shapeParams.size(); i++) *out << shapeParams[i] << "  ";
   *out << std::endl;
   meshMover->moveMesh(shapeParams, morphFromInit);
+  disc->coordinatesChanged();
   coords = disc->getCoords();
 
   for (int i=0; i<num_sp; i++) {
@@ -2683,6 +2934,14 @@ shapeParamsHaveBeenReset = false;
 
     workset.coord_deriv_indices = &coord_deriv_indices;
 
+    if (numWorksetThreads > 1) {
+      evaluateWorksetsThreaded<PHAL::AlbanyTraits::Tangent>(workset,
+          [&](PHAL::Workset& ws_workset, int const ws) {
+            loadWorksetBucketInfo<PHAL::AlbanyTraits::Tangent>(ws_workset, ws);
+            ws_workset.ws_coord_derivs = ws_coord_derivs[ws];
+          });
+    }
+    else
     for (int ws = 0; ws < numWorksets; ws++) {
       loadWorksetBucketInfo<PHAL::AlbanyTraits::Tangent>(workset, ws);
       workset.ws_coord_derivs = ws_coord_derivs[ws];
@@ -2934,6 +3193,7 @@ applyGlobalDistParamDerivImplT(const double current_time,
     for (unsigned int i=0; i<shapeParams.size(); i++) *out << shapeParams[i] << "  ";
     *out << std::endl;
     meshMover->moveMesh(shapeParams, morphFromInit);
+    disc->coordinatesChanged();
     coords = disc->getCoords();
     shapeParamsHaveBeenReset = false;
   }
@@ -3324,6 +3584,7 @@ computeGlobalSGResidual(
     for (unsigned int i=0; i<shapeParams.size(); i++) *out << shapeParams[i] << "  ";
     *out << std::endl;
     meshMover->moveMesh(shapeParams, morphFromInit);
+    disc->coordinatesChanged();
     coords = disc->getCoords();
     shapeParamsHaveBeenReset = false;
   }
@@ -3504,6 +3765,7 @@ computeGlobalSGJacobian(
     for (unsigned int i=0; i<shapeParams.size(); i++) *out << shapeParams[i] << "  ";
     *out << std::endl;
     meshMover->moveMesh(shapeParams, morphFromInit);
+    disc->coordinatesChanged();
     coords = disc->getCoords();
     shapeParamsHaveBeenReset = false;
   }
@@ -4037,6 +4299,7 @@ computeGlobalMPResidual(
     for (unsigned int i=0; i<shapeParams.size(); i++) *out << shapeParams[i] << "  ";
     *out << std::endl;
     meshMover->moveMesh(shapeParams, morphFromInit);
+    disc->coordinatesChanged();
     coords = disc->getCoords();
     shapeParamsHaveBeenReset = false;
   }
@@ -4206,6 +4469,7 @@ computeGlobalMPJacobian(
     for (unsigned int i=0; i<shapeParams.size(); i++) *out << shapeParams[i] << "  ";
     *out << std::endl;
     meshMover->moveMesh(shapeParams, morphFromInit);
+    disc->coordinatesChanged();
     coords = disc->getCoords();
     shapeParamsHaveBeenReset = false;
   }
@@ -4836,6 +5100,8 @@ Albany::Application::getValue(const std::string& name)
       "   Unrecognized param name: " << name << std::endl);
 
   shapeParamsHaveBeenReset = true;
+  // The mesh will be moved before the next evaluation
+  if (!geometryCache.is_null()) geometryCache->clear();
 
   return shapeParams[index];
 }
@@ -4850,6 +5116,10 @@ postRegSetup(std::string eval)
   if (eval == "Residual") {
     for (int ps = 0; ps < fm.size(); ps++)
       fm[ps]->postRegistrationSetupForType<PHAL::AlbanyTraits::Residual>(eval);
+    for (int t = 0; t < threadFm.size(); t++)
+      for (int ps = 0; ps < threadFm[t].size(); ps++)
+        threadFm[t][ps]
+            ->postRegistrationSetupForType<PHAL::AlbanyTraits::Residual>(eval);
     if (dfm != Teuchos::null)
       dfm->postRegistrationSetupForType<PHAL::AlbanyTraits::Residual>(eval);
     if (nfm != Teuchos::null)
@@ -4868,6 +5138,13 @@ postRegSetup(std::string eval)
       fm[ps]->setKokkosExtendedDataTypeDimensions<PHAL::AlbanyTraits::Jacobian>(
           derivative_dimensions);
       fm[ps]->postRegistrationSetupForType<PHAL::AlbanyTraits::Jacobian>(eval);
+      for (int t = 0; t < threadFm.size(); t++) {
+        threadFm[t][ps]
+            ->setKokkosExtendedDataTypeDimensions<PHAL::AlbanyTraits::Jacobian>(
+            derivative_dimensions);
+        threadFm[t][ps]
+            ->postRegistrationSetupForType<PHAL::AlbanyTraits::Jacobian>(eval);
+      }
       if (nfm != Teuchos::null && ps < nfm.size()) {
         nfm[ps]
             ->setKokkosExtendedDataTypeDimensions<PHAL::AlbanyTraits::Jacobian>(
@@ -4898,6 +5175,13 @@ postRegSetup(std::string eval)
       fm[ps]->setKokkosExtendedDataTypeDimensions<PHAL::AlbanyTraits::Tangent>(
           derivative_dimensions);
       fm[ps]->postRegistrationSetupForType<PHAL::AlbanyTraits::Tangent>(eval);
+      for (int t = 0; t < threadFm.size(); t++) {
+        threadFm[t][ps]
+            ->setKokkosExtendedDataTypeDimensions<PHAL::AlbanyTraits::Tangent>(
+            derivative_dimensions);
+        threadFm[t][ps]
+            ->postRegistrationSetupForType<PHAL::AlbanyTraits::Tangent>(eval);
+      }
       if (nfm != Teuchos::null && ps < nfm.size()) {
         nfm[ps]
             ->setKokkosExtendedDataTypeDimensions<PHAL::AlbanyTraits::Tangent>(
@@ -6240,6 +6524,7 @@ computeGlobalResidualSDBCsImplT(
     }
     *out << std::endl;
     meshMover->moveMesh(shapeParams, morphFromInit);
+    disc->coordinatesChanged();
     coords = disc->getCoords();
     shapeParamsHaveBeenReset = false;
   }
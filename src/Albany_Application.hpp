@@ -26,6 +26,7 @@
 #include "Albany_AbstractProblem.hpp"
 #include "Albany_AbstractResponseFunction.hpp"
 #include "Albany_StateManager.hpp"
+#include "Albany_WorksetThreads.hpp"
 
 #if defined(ALBANY_EPETRA)
 #include "AAdapt_AdaptiveSolutionManager.hpp"
@@ -220,6 +221,18 @@ namespace Albany {
                                const Teuchos::Array<ParamVec>& p,
                                Tpetra_Vector& fT);
 
+     //! Evaluate the residual with the workset coefficients alpha = beta = 0
+     //! and omega = 1, i.e. only the terms that the Jacobian fill of the same
+     //! coefficients differentiates. For Aeras::ShallowWaterResid with
+     //! explicit hyperviscosity this is the Laplacian applied to xdotdotT,
+     //! formed element by element without building an operator.
+     void computeGlobalLaplaceT(const double current_time,
+                                const Tpetra_Vector* xdotT,
+                                const Tpetra_Vector& xdotdotT,
+                                const Tpetra_Vector& xT,
+                                const Teuchos::Array<ParamVec>& p,
+                                Tpetra_Vector& fT);
+
   private:
 
      void computeGlobalResidualImplT(const double current_time,
@@ -268,6 +281,23 @@ namespace Albany {
                                  Tpetra_Vector* fT,
                                  Tpetra_CrsMatrix& jacT);
 
+     //! Compute only the diagonal of the global Jacobian
+     /*!
+      * Element derivatives are scattered into matrices holding only the
+      * diagonal, so no full Jacobian is assembled or exported. Dirichlet
+      * rows get the same diagonal as in computeGlobalJacobianT; scaling is
+      * not applied.
+      */
+     void computeGlobalJacobianDiagonalT(const double alpha,
+                                         const double beta,
+                                         const double omega,
+                                         const double current_time,
+                                         const Tpetra_Vector* xdotT,
+                                         const Tpetra_Vector* xdotdotT,
+                                         const Tpetra_Vector& xT,
+                                         const Teuchos::Array<ParamVec>& p,
+                                         Tpetra_Vector& diagT);
+
   private:
 
      void computeGlobalJacobianImplT(const double alpha,
@@ -279,7 +309,8 @@ namespace Albany {
                                      const Teuchos::RCP<const Tpetra_Vector>& xT,
                                      const Teuchos::Array<ParamVec>& p,
                                      const Teuchos::RCP<Tpetra_Vector>& fT,
-                                     const Teuchos::RCP<Tpetra_CrsMatrix>& jacT);
+                                     const Teuchos::RCP<Tpetra_CrsMatrix>& jacT,
+                                     const bool diagonalOnly = false);
 
   public:
 
@@ -788,6 +819,14 @@ namespace Albany {
     template <typename EvalT>
     void loadWorksetBucketInfo(PHAL::Workset& workset, const int& ws);
 
+    //! Evaluate the volume field managers on all worksets using
+    //! numWorksetThreads threads. Each thread works on its own copy of
+    //! workset; setup(workset, ws) loads the per-workset data and is always
+    //! called on the calling thread.
+    template <typename EvalT, typename Setup>
+    void evaluateWorksetsThreaded(PHAL::Workset const& workset,
+                                  Setup const& setup);
+
 #if defined(ALBANY_EPETRA)
     void loadBasicWorksetInfo(
             PHAL::Workset& workset,
@@ -1175,6 +1214,22 @@ namespace Albany {
     //! Phalanx Field Manager for states
     Teuchos::Array< Teuchos::RCP<PHX::FieldManager<PHAL::AlbanyTraits>>> sfm;
 
+    //! Number of threads evaluating worksets concurrently ("Workset Threads")
+    int numWorksetThreads;
+
+    //! Volume field managers for threads 1..numWorksetThreads-1 (thread 0 uses fm)
+    Teuchos::Array<Teuchos::Array<Teuchos::RCP<PHX::FieldManager<PHAL::AlbanyTraits>>>> threadFm;
+
+    //! Workset coloring used by threaded fills, and the mesh version it was built for
+    Teuchos::Array<Teuchos::Array<int>> wsColors;
+    int wsColorsMeshVersion;
+
+    //! Scratch arena of each workset thread; empty if "Workset Scratch Size" is 0
+    Teuchos::Array<Teuchos::RCP<PHAL::WorksetScratch>> wsScratch;
+
+    //! Basis functions kept across evaluations; null unless "Cache Basis Functions"
+    Teuchos::RCP<PHAL::GeometryCache> geometryCache;
+
 #ifdef ALBANY_STOKHOS
     //! Stochastic Galerkin basis
     Teuchos::RCP<const Stokhos::OrthogPolyBasis<int,double>> sg_basis;
@@ -1299,6 +1354,10 @@ namespace Albany {
     Teuchos::Array<Teuchos::Array<int>> offsets_;
     Teuchos::RCP<Tpetra_Vector> scaleVec_;  
 
+    //Diagonal-only owned and overlapped Jacobians for computeGlobalJacobianDiagonalT
+    Teuchos::RCP<Tpetra_CrsMatrix> jacDiagT_;
+    Teuchos::RCP<Tpetra_CrsMatrix> overlappedJacDiagT_;
+
     //boolean read from input file telling code whether to compute/print responses every step 
     bool observe_responses; 
     
@@ -1324,13 +1383,30 @@ void Albany::Application::loadWorksetBucketInfo(PHAL::Workset& workset,
 
   workset.numCells = wsElNodeEqID[ws].dimension(0);
   workset.wsElNodeEqID = wsElNodeEqID[ws];
+  const auto& wsJacOffsets = disc->getWsJacobianOffsets();
+  // The offsets index the full overlapped Jacobian
+  if (wsJacOffsets.size() > 0 && !workset.jacobian_diagonal_only)
+    workset.wsJacOffsets = wsJacOffsets[ws];
   workset.wsElNodeID = wsElNodeID[ws];
   workset.wsCoords = coords[ws];
+  const auto& packedCoords = disc->getPackedCoords();
+  if (packedCoords.size() > 0) workset.wsPackedCoords = packedCoords[ws];
   workset.wsSphereVolume = sphereVolume[ws];
   workset.wsLatticeOrientation = latticeOrientation[ws];
   workset.EBName = wsEBNames[ws];
   workset.wsIndex = ws;
 
+  // Temporaries of the previous workset are dropped in one go
+  if (wsScratch.size() > 0) {
+    if (workset.scratch.is_null()) workset.scratch = wsScratch[0];
+    workset.scratch->reset();
+  }
+
+  if (!geometryCache.is_null()) {
+    geometryCache->setMeshVersion(disc->getMeshVersion());
+    workset.geometryCache = geometryCache;
+  }
+
   workset.local_Vp.resize(workset.numCells);
 
 //  workset.print(*out);
@@ -1339,8 +1415,10 @@ void Albany::Application::loadWorksetBucketInfo(PHAL::Workset& workset,
   loadWorksetSidesetInfo(workset, ws);
 
   workset.stateArrayPtr = &stateMgr.getStateArray(Albany::StateManager::ELEM, ws);
+  workset.stateHandlesPtr = &stateMgr.getStateHandles();
+  workset.stateHandleArrayPtr = &stateMgr.getStateHandleArray(ws);
+  workset.disc = disc;  // Needed by FELIX for sideset DOF save and for the mesh version
 #if defined(ALBANY_EPETRA)
-  workset.disc = disc;  // Needed by FELIX for sideset DOF save
   workset.eigenDataPtr = stateMgr.getEigenData();
   workset.auxDataPtr = stateMgr.getAuxData();
 #endif
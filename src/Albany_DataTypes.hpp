@@ -24,6 +24,7 @@
 #include "Sacado_ELRCacheFad_DFad.hpp"
 #include "Sacado_Fad_DFad.hpp"
 #include "Sacado_Fad_SLFad.hpp"
+#include "Sacado_Fad_SFad.hpp"
 #include "Sacado_ELRFad_SLFad.hpp"
 #include "Sacado_ELRFad_SFad.hpp"
 #include "Sacado_CacheFad_DFad.hpp"
@@ -61,13 +62,25 @@ typedef Sacado::MP::Vector<MPStorageType> MPType;
 #endif
 
 // Switch between dynamic and static FAD types
-#ifdef ALBANY_FAST_FELIX
+#if defined(ALBANY_SFAD)
+  // Fixed-size derivative array sized for one element of the target problem,
+  // e.g. 24 for Hex8 with 3 dofs/node. Problems with any other number of
+  // element dofs are rejected at setup (see PHAL::getDerivativeDimensions).
+#define ALBANY_FADTYPE_NOTEQUAL_TANFADTYPE
+  typedef Sacado::Fad::SFad<RealType, ALBANY_SFAD_SIZE> FadType;
+#ifdef ALBANY_STOKHOS
+  typedef Sacado::Fad::SFad<SGType, ALBANY_SFAD_SIZE> SGFadType;
+  typedef Sacado::Fad::SFad<MPType, ALBANY_SFAD_SIZE> MPFadType;
+#endif
+#elif defined(ALBANY_FAST_FELIX)
   // Code templated on data type need to know if FadType and TanFadType
   // are the same or different typdefs
 #define ALBANY_FADTYPE_NOTEQUAL_TANFADTYPE
   typedef Sacado::Fad::SLFad<RealType, ALBANY_SLFAD_SIZE> FadType;
+#ifdef ALBANY_STOKHOS
   typedef Sacado::Fad::SLFad<SGType, ALBANY_SLFAD_SIZE> SGFadType;
   typedef Sacado::Fad::SLFad<MPType, ALBANY_SLFAD_SIZE> MPFadType;
+#endif
 #else
 #define ALBANY_SFAD_SIZE 300
   typedef Sacado::Fad::DFad<RealType> FadType;
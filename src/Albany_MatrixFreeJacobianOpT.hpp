@@ -0,0 +1,216 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_MATRIX_FREE_JACOBIAN_OP_T_HPP
+#define ALBANY_MATRIX_FREE_JACOBIAN_OP_T_HPP
+
+#include "Albany_DataTypes.hpp"
+#include "PHAL_AlbanyTraits.hpp"
+
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_TestForException.hpp"
+
+#include "Albany_Application.hpp"
+
+namespace Albany {
+
+  //! Tpetra_Operator implementing the action of the Jacobian without assembling it
+  /*!
+   * This class implements the Tpetra_Operator interface for
+   * W*v = (alpha*df/dxdot + beta*df/dx + omega*df/dxdotdot)*v, where f is
+   * the Albany residual vector, evaluated at the point given by set().
+   * Each column of v is pushed through the Tangent evaluation type as a
+   * single direction, so no Jacobian matrix is ever stored.
+   *
+   * Since there is no matrix, Stratimikos preconditioners (Ifpack2, MueLu)
+   * cannot be built from this operator; the model evaluator supplies the
+   * preconditioner instead (see MatrixFreeJacobiPrecT).
+   */
+  class MatrixFreeJacobianOpT : public Tpetra_Operator {
+  public:
+
+    // Constructor
+    MatrixFreeJacobianOpT(const Teuchos::RCP<Application>& app_) :
+      app(app_),
+      alpha(0.0), beta(1.0), omega(0.0), time(0.0) {}
+
+    //! Destructor
+    virtual ~MatrixFreeJacobianOpT() {}
+
+    //! Set the point and coefficients at which W is applied
+    /*!
+     * The vectors and the parameter values are copied since the solver may
+     * change them before the linear solve that uses this operator is over.
+     */
+    void set(const double alpha_, const double beta_, const double omega_,
+             const double time_,
+             const Teuchos::RCP<const Tpetra_Vector>& xdot_,
+             const Teuchos::RCP<const Tpetra_Vector>& xdotdot_,
+             const Teuchos::RCP<const Tpetra_Vector>& x_,
+             const Teuchos::Array<ParamVec>& scalar_params_) {
+      alpha = alpha_;
+      beta = beta_;
+      omega = omega_;
+      time = time_;
+      xdot = Teuchos::nonnull(xdot_) ?
+        Teuchos::rcp(new Tpetra_Vector(*xdot_, Teuchos::Copy)) : Teuchos::null;
+      xdotdot = Teuchos::nonnull(xdotdot_) ?
+        Teuchos::rcp(new Tpetra_Vector(*xdotdot_, Teuchos::Copy)) : Teuchos::null;
+      x = Teuchos::rcp(new Tpetra_Vector(*x_, Teuchos::Copy));
+      scalar_params = Teuchos::rcp(new Teuchos::Array<ParamVec>(scalar_params_));
+    }
+
+    //! @name Tpetra_Operator methods
+    //@{
+
+    /*!
+     * \brief Returns the result of a Tpetra_Operator applied to a
+     * Tpetra_MultiVector X in Y.
+     */
+    virtual void apply(const Tpetra_MultiVector& X,
+                      Tpetra_MultiVector& Y,  Teuchos::ETransp  mode = Teuchos::NO_TRANS,
+                      ST a = Teuchos::ScalarTraits<ST>::one(),
+                      ST b = Teuchos::ScalarTraits<ST>::zero() ) const {
+      TEUCHOS_TEST_FOR_EXCEPTION(mode != Teuchos::NO_TRANS, std::logic_error,
+        "MatrixFreeJacobianOpT: only W*v is available, not its transpose" << std::endl);
+      TEUCHOS_TEST_FOR_EXCEPTION(Teuchos::is_null(x), std::logic_error,
+        "MatrixFreeJacobianOpT: apply() called before set()" << std::endl);
+
+      Tpetra_MultiVector WV(Y.getMap(), 1, false);
+      for (std::size_t k = 0; k < X.getNumVectors(); ++k) {
+        // The same direction seeds x, xdot and xdotdot; the Gather evaluators
+        // scale them by beta, alpha and omega
+        Teuchos::RCP<const Tpetra_Vector> V = X.getVector(k);
+        app->computeGlobalTangentT(alpha, beta, omega, time, false,
+                                   xdot.get(), xdotdot.get(), *x, *scalar_params,
+                                   NULL, V.get(),
+                                   Teuchos::nonnull(xdot) ? V.get() : NULL,
+                                   Teuchos::nonnull(xdotdot) ? V.get() : NULL,
+                                   NULL, NULL, &WV, NULL);
+        Y.getVectorNonConst(k)->update(a, *WV.getVector(0), b);
+      }
+    }
+
+    //! Returns a character string describing the operator
+    virtual const char * Label() const {
+      return "MatrixFreeJacobianOpT";
+    }
+
+    virtual bool hasTransposeApply() const {
+      return false;
+    }
+
+    /*!
+     * \brief Returns the Tpetra_Map object associated with the domain of
+     * this operator.
+     */
+    virtual Teuchos::RCP<const Tpetra_Map> getDomainMap() const {
+      return app->getMapT();
+    }
+
+    /*!
+     * \brief Returns the Tpetra_Map object associated with the range of
+     * this operator.
+     */
+    virtual Teuchos::RCP<const Tpetra_Map> getRangeMap() const {
+      return app->getMapT();
+    }
+
+    //@}
+
+  protected:
+
+    //! Albany applications
+    Teuchos::RCP<Application> app;
+
+    //! @name Data needed for apply()
+    //@{
+
+    //! Coefficients of df/dxdot, df/dx and df/dxdotdot
+    double alpha, beta, omega;
+
+    //! Current time
+    double time;
+
+    //! Velocity vector
+    Teuchos::RCP<const Tpetra_Vector> xdot;
+
+    //! Acceleration vector
+    Teuchos::RCP<const Tpetra_Vector> xdotdot;
+
+    //! Solution vector
+    Teuchos::RCP<const Tpetra_Vector> x;
+
+    //! Scalar parameters
+    Teuchos::RCP<Teuchos::Array<ParamVec> > scalar_params;
+
+    //@}
+
+  }; // class MatrixFreeJacobianOpT
+
+  //! Jacobi preconditioner for the matrix-free Jacobian
+  /*!
+   * Applies the inverse of the Jacobian diagonal, which is computed without
+   * assembling the Jacobian (see Application::computeGlobalJacobianDiagonalT).
+   */
+  class MatrixFreeJacobiPrecT : public Tpetra_Operator {
+  public:
+
+    // Constructor
+    MatrixFreeJacobiPrecT(const Teuchos::RCP<const Tpetra_Map>& map) :
+      inv_diag(Teuchos::rcp(new Tpetra_Vector(map))) {
+      inv_diag->putScalar(1.0);
+    }
+
+    //! Destructor
+    virtual ~MatrixFreeJacobiPrecT() {}
+
+    //! Take the inverse of the diagonal of W; zero entries are left alone
+    void setDiagonal(const Tpetra_Vector& diag) {
+      inv_diag->assign(diag);
+      Teuchos::ArrayRCP<ST> d = inv_diag->get1dViewNonConst();
+      for (LO i = 0; i < d.size(); ++i)
+        d[i] = d[i] == 0.0 ? 1.0 : 1.0 / d[i];
+    }
+
+    //! @name Tpetra_Operator methods
+    //@{
+
+    virtual void apply(const Tpetra_MultiVector& X,
+                      Tpetra_MultiVector& Y,  Teuchos::ETransp  mode = Teuchos::NO_TRANS,
+                      ST a = Teuchos::ScalarTraits<ST>::one(),
+                      ST b = Teuchos::ScalarTraits<ST>::zero() ) const {
+      Y.elementWiseMultiply(a, *inv_diag, X, b);
+    }
+
+    virtual const char * Label() const {
+      return "MatrixFreeJacobiPrecT";
+    }
+
+    virtual bool hasTransposeApply() const {
+      return true;
+    }
+
+    virtual Teuchos::RCP<const Tpetra_Map> getDomainMap() const {
+      return inv_diag->getMap();
+    }
+
+    virtual Teuchos::RCP<const Tpetra_Map> getRangeMap() const {
+      return inv_diag->getMap();
+    }
+
+    //@}
+
+  protected:
+
+    //! Inverse of the Jacobian diagonal
+    Teuchos::RCP<Tpetra_Vector> inv_diag;
+
+  }; // class MatrixFreeJacobiPrecT
+
+} // namespace Albany
+
+#endif // ALBANY_MATRIX_FREE_JACOBIAN_OP_T_HPP
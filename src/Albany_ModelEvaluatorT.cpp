@@ -8,9 +8,24 @@
 
 #include "Albany_ModelEvaluatorT.hpp"
 #include "Albany_DistributedParameterDerivativeOpT.hpp"
+#include "Piro_StratimikosUtils.hpp"
+#include "Stratimikos_DefaultLinearSolverBuilder.hpp"
 #include "Teuchos_ScalarTraits.hpp"
 #include "Teuchos_TestForException.hpp"
 #include "Tpetra_ConfigDefs.hpp"
+#include "Teuchos_CommHelpers.hpp"
+
+#include <algorithm>
+
+#ifdef ALBANY_IFPACK2
+#include "Ifpack2_Factory.hpp"
+#include "Teuchos_AbstractFactoryStd.hpp"
+#include "Thyra_Ifpack2PreconditionerFactory.hpp"
+#endif
+
+#ifdef ALBANY_MUELU
+#include "Stratimikos_MueLuHelpers.hpp"
+#endif
 
 // uncomment the following to write stuff out to matrix market to debug
 //#define WRITE_TO_MATRIX_MARKET
@@ -268,6 +283,195 @@ Albany::ModelEvaluatorT::ModelEvaluatorT(
   }
 
   timer = Teuchos::TimeMonitor::getNewTimer("Albany: **Total Fill Time**");
+
+  // Distributed parameters are not part of the cached point, so they turn the
+  // cache off
+  cache_results = problemParams.get("Cache Residual", false);
+  if (cache_results && num_dist_param_vecs > 0) {
+    *out << "Warning: Cache Residual is not supported with "
+            "distributed parameters and is disabled" << std::endl;
+    cache_results = false;
+  }
+#if defined(ALBANY_LCM)
+  // The residual of a Schwarz coupled application also depends on the
+  // solutions of the other applications, which are not part of the cached
+  // point either
+  if (cache_results && app->getApplications().size() > 1) {
+    *out << "Warning: Cache Residual is not supported with "
+            "coupled applications and is disabled" << std::endl;
+    cache_results = false;
+  }
+#endif
+  if (cache_results) {
+    cache_hit_timer =
+        Teuchos::TimeMonitor::getNewTimer("Albany: Fill Cache Hits");
+    cache_miss_timer =
+        Teuchos::TimeMonitor::getNewTimer("Albany: Fill Cache Misses");
+  }
+
+  matrix_free = problemParams.get("Matrix-Free Jacobian", false);
+  mf_prec_type = problemParams.get<std::string>(
+      "Matrix-Free Preconditioner Type", "Jacobi");
+  mf_prec_lag = problemParams.get("Matrix-Free Preconditioner Lag", 5);
+  mf_prec_params = Teuchos::rcp(new Teuchos::ParameterList(
+      problemParams.sublist("Matrix-Free Preconditioner Parameters")));
+  mf_prec_age = 0;
+  if (matrix_free) {
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        supplies_prec, Teuchos::Exceptions::InvalidParameter,
+        std::endl
+            << "Error!  In Albany::ModelEvaluatorT constructor:  "
+            << "Matrix-Free Jacobian cannot be combined with a preconditioner "
+               "supplied by the problem" << std::endl);
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        mf_prec_lag < 1, Teuchos::Exceptions::InvalidParameter,
+        std::endl
+            << "Error!  In Albany::ModelEvaluatorT constructor:  "
+            << "Matrix-Free Preconditioner Lag must be at least 1" << std::endl);
+#ifndef ALBANY_IFPACK2
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        mf_prec_type != "None" && mf_prec_type != "Jacobi",
+        Teuchos::Exceptions::InvalidParameter,
+        std::endl
+            << "Error!  In Albany::ModelEvaluatorT constructor:  "
+            << "Matrix-Free Preconditioner Type " << mf_prec_type
+            << " requires Ifpack2; use Jacobi or None" << std::endl);
+#endif
+    // There is no matrix for a Stratimikos preconditioner to be built from
+    const Teuchos::RCP<Teuchos::ParameterList> stratList =
+        Piro::extractStratimikosParams(Teuchos::sublist(appParams, "Piro"));
+    const std::string strat_prec_type =
+        Teuchos::nonnull(stratList) &&
+                stratList->isType<std::string>("Preconditioner Type")
+            ? stratList->get<std::string>("Preconditioner Type")
+            : "ML";
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        Teuchos::nonnull(stratList) && strat_prec_type != "None",
+        Teuchos::Exceptions::InvalidParameter,
+        std::endl
+            << "Error!  In Albany::ModelEvaluatorT constructor:  "
+            << "Matrix-Free Jacobian cannot be used with the Stratimikos "
+               "preconditioner " << strat_prec_type
+            << ". Set the Stratimikos Preconditioner Type to None and choose "
+               "the preconditioner with Matrix-Free Preconditioner Type."
+            << std::endl);
+    *out << "Using a matrix-free Jacobian";
+    if (mf_prec_type != "None")
+      *out << " with a " << mf_prec_type << " preconditioner rebuilt every "
+           << mf_prec_lag << " Jacobian evaluation(s)";
+    *out << std::endl;
+  }
+
+  // Preconditioner built here, instead of by the linear solver, so that it
+  // can be kept across Jacobians
+  Teuchos::ParameterList& reuseParams =
+      problemParams.sublist("Preconditioner Reuse");
+  reuseParams.validateParametersAndSetDefaults(
+      *Albany::PreconditionerReuseT::getValidParameters(), 0);
+  if (reuseParams.get<bool>("Enable")) {
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        supplies_prec || matrix_free, Teuchos::Exceptions::InvalidParameter,
+        std::endl
+            << "Error!  In Albany::ModelEvaluatorT constructor:  "
+            << "Preconditioner Reuse cannot be combined with Matrix-Free "
+               "Jacobian or a preconditioner supplied by the problem"
+            << std::endl);
+    const Teuchos::RCP<Teuchos::ParameterList> stratList =
+        Piro::extractStratimikosParams(Teuchos::sublist(appParams, "Piro"));
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        Teuchos::is_null(stratList) ||
+            !stratList->isType<std::string>("Preconditioner Type") ||
+            stratList->get<std::string>("Preconditioner Type") == "None",
+        Teuchos::Exceptions::InvalidParameter,
+        std::endl
+            << "Error!  In Albany::ModelEvaluatorT constructor:  "
+            << "Preconditioner Reuse needs a Stratimikos Preconditioner Type"
+            << std::endl);
+    Stratimikos::DefaultLinearSolverBuilder linearSolverBuilder;
+#ifdef ALBANY_IFPACK2
+    typedef Thyra::PreconditionerFactoryBase<ST> Base;
+    typedef Thyra::Ifpack2PreconditionerFactory<Tpetra_CrsMatrix> Impl;
+    linearSolverBuilder.setPreconditioningStrategyFactory(
+        Teuchos::abstractFactoryStd<Base, Impl>(), "Ifpack2");
+#endif
+#ifdef ALBANY_MUELU
+    Stratimikos::enableMueLu<LO, GO, KokkosNode>(linearSolverBuilder);
+#endif
+    linearSolverBuilder.setParameterList(stratList);
+    prec_reuse = Teuchos::rcp(new Albany::PreconditionerReuseT(
+        reuseParams, linearSolverBuilder.createPreconditioningStrategy("")));
+    *out << "Reusing the Stratimikos preconditioner across Jacobians"
+         << std::endl;
+  }
+}
+
+namespace {
+// Same values in a (or absent) and in the cached copy b, on this rank
+bool
+sameLocalValues(
+    const Tpetra_Vector* a, const Teuchos::RCP<Tpetra_Vector>& b,
+    const bool has_b) {
+  if (a == NULL || !has_b) return a == NULL && !has_b;
+  if (a->getLocalLength() != b->getLocalLength()) return false;
+  const Teuchos::ArrayRCP<const ST> av = a->get1dView();
+  const Teuchos::ArrayRCP<const ST> bv = b->get1dView();
+  return std::equal(av.begin(), av.end(), bv.begin());
+}
+
+// Copy a into the cached vector b, reallocating b if the maps differ
+void
+copyToCache(const Tpetra_Vector* a, Teuchos::RCP<Tpetra_Vector>& b) {
+  if (a == NULL) return;
+  if (Teuchos::is_null(b) || b->getMap() != a->getMap())
+    b = Teuchos::rcp(new Tpetra_Vector(a->getMap()));
+  b->assign(*a);
+}
+}  // namespace
+
+bool
+Albany::ModelEvaluatorT::isCachedPoint(
+    const Tpetra_Vector& xT, const Tpetra_Vector* x_dotT,
+    const Tpetra_Vector* x_dotdotT, const double time) const {
+  // Time, parameters and versions are the same on all ranks
+  bool same = cache.valid && time == cache.time &&
+              app->getStateMgr().getStateVersion() == cache.state_version &&
+              app->getDiscretization()->getMeshVersion() == cache.mesh_version;
+  for (int l = 0; same && l < sacado_param_vec.size(); ++l)
+    for (unsigned int k = 0; same && k < sacado_param_vec[l].size(); ++k)
+      same = sacado_param_vec[l][k].baseValue == cache.params[l][k];
+  if (!same) return false;
+
+  const int local_same =
+      sameLocalValues(&xT, cache.x, true) &&
+      sameLocalValues(x_dotT, cache.x_dot, cache.has_x_dot) &&
+      sameLocalValues(x_dotdotT, cache.x_dotdot, cache.has_x_dotdot);
+  int global_same = 0;
+  Teuchos::reduceAll<int, int>(
+      *app->getComm(), Teuchos::REDUCE_MIN, local_same,
+      Teuchos::outArg(global_same));
+  return global_same == 1;
+}
+
+void
+Albany::ModelEvaluatorT::setCachedPoint(
+    const Tpetra_Vector& xT, const Tpetra_Vector* x_dotT,
+    const Tpetra_Vector* x_dotdotT, const double time) const {
+  copyToCache(&xT, cache.x);
+  copyToCache(x_dotT, cache.x_dot);
+  copyToCache(x_dotdotT, cache.x_dotdot);
+  cache.has_x_dot = x_dotT != NULL;
+  cache.has_x_dotdot = x_dotdotT != NULL;
+  cache.time = time;
+  cache.params.resize(sacado_param_vec.size());
+  for (int l = 0; l < sacado_param_vec.size(); ++l) {
+    cache.params[l].resize(sacado_param_vec[l].size());
+    for (unsigned int k = 0; k < sacado_param_vec[l].size(); ++k)
+      cache.params[l][k] = sacado_param_vec[l][k].baseValue;
+  }
+  cache.state_version = app->getStateMgr().getStateVersion();
+  cache.mesh_version = app->getDiscretization()->getMeshVersion();
+  cache.valid = true;
+  cache.f_valid = false;
 }
 
 void
@@ -399,6 +603,11 @@ Albany::ModelEvaluatorT::getUpperBounds() const {
 
 Teuchos::RCP<Thyra::LinearOpBase<ST>>
 Albany::ModelEvaluatorT::create_W_op() const {
+  if (matrix_free) {
+    const Teuchos::RCP<Tpetra_Operator> W =
+        Teuchos::rcp(new Albany::MatrixFreeJacobianOpT(app));
+    return Thyra::createLinearOp(W);
+  }
   const Teuchos::RCP<Tpetra_Operator> W =
       Teuchos::rcp(new Tpetra_CrsMatrix(app->getJacobianGraphT()));
   return Thyra::createLinearOp(W);
@@ -406,8 +615,37 @@ Albany::ModelEvaluatorT::create_W_op() const {
 
 Teuchos::RCP<Thyra::PreconditionerBase<ST>>
 Albany::ModelEvaluatorT::create_W_prec() const {
+  if (Teuchos::nonnull(prec_reuse)) return prec_reuse->createPrec();
+
   Teuchos::RCP<Thyra::DefaultPreconditioner<ST>> W_prec =
       Teuchos::rcp(new Thyra::DefaultPreconditioner<ST>);
+
+  if (matrix_free && mf_prec_type == "Jacobi") {
+    // Set from the Jacobian diagonal in evalModelImpl, see mf_prec_lag
+    mf_jacobi = Teuchos::rcp(new Albany::MatrixFreeJacobiPrecT(app->getMapT()));
+    mf_prec_age = 0;
+
+    const Teuchos::RCP<Tpetra_Operator> precOp = mf_jacobi;
+    W_prec->initializeRight(Thyra::createLinearOp(precOp));
+    return W_prec;
+  }
+#ifdef ALBANY_IFPACK2
+  if (matrix_free) {
+    // Built from an assembled Jacobian in evalModelImpl, see mf_prec_lag.
+    // Ifpack2 keeps a reference to the matrix, so it stays allocated.
+    mf_prec_jac = Teuchos::rcp(new Tpetra_CrsMatrix(app->getJacobianGraphT()));
+    mf_prec_jac->fillComplete();
+    Ifpack2::Factory factory;
+    mf_prec = factory.create<Tpetra_RowMatrix>(mf_prec_type, mf_prec_jac);
+    mf_prec->setParameters(*mf_prec_params);
+    mf_prec->initialize();
+    mf_prec_age = 0;
+
+    const Teuchos::RCP<Tpetra_Operator> precOp = mf_prec;
+    W_prec->initializeRight(Thyra::createLinearOp(precOp));
+    return W_prec;
+  }
+#endif
   Teuchos::RCP<Tpetra_Operator> precOp = app->getPreconditionerT();
   Teuchos::RCP<Thyra::LinearOpBase<ST>> precOp_thyra =
       Thyra::createLinearOp(precOp);
@@ -517,7 +755,8 @@ Albany::ModelEvaluatorT::createOutArgsImpl() const {
 
   result.setSupports(Thyra::ModelEvaluatorBase::OUT_ARG_f, true);
 
-  if (supplies_prec)
+  if (supplies_prec || (matrix_free && mf_prec_type != "None") ||
+      Teuchos::nonnull(prec_reuse))
     result.setSupports(Thyra::ModelEvaluatorBase::OUT_ARG_W_prec, true);
 
   result.setSupports(Thyra::ModelEvaluatorBase::OUT_ARG_W_op, true);
@@ -712,9 +951,16 @@ Albany::ModelEvaluatorT::evalModelImpl(
           : Teuchos::null;
 #endif
 
+  // A matrix-free W only needs the point at which it will be applied
+  const Teuchos::RCP<Albany::MatrixFreeJacobianOpT> W_op_out_mfT =
+      (matrix_free && Teuchos::nonnull(W_op_outT))
+          ? Teuchos::rcp_dynamic_cast<Albany::MatrixFreeJacobianOpT>(
+                W_op_outT, true)
+          : Teuchos::null;
+
   // Cast W to a CrsMatrix, throw an exception if this fails
   const Teuchos::RCP<Tpetra_CrsMatrix> W_op_out_crsT =
-      Teuchos::nonnull(W_op_outT)
+      (!matrix_free && Teuchos::nonnull(W_op_outT))
           ? Teuchos::rcp_dynamic_cast<Tpetra_CrsMatrix>(W_op_outT, true)
           : Teuchos::null;
 
@@ -732,11 +978,28 @@ Albany::ModelEvaluatorT::evalModelImpl(
   //
   bool f_already_computed = false;
 
+  // Line searches, convergence tests and observers often ask again for f at
+  // the point just evaluated. W is always filled again when requested: the
+  // solver may have scaled or equilibrated it in place.
+  const bool use_cache = cache_results && !app->is_adjoint &&
+                         Teuchos::nonnull(fT_out);
+  bool at_cached_point = false;
+  if (use_cache) {
+    at_cached_point =
+        isCachedPoint(*xT, x_dotT.get(), x_dotdotT.get(), curr_time);
+    if (!at_cached_point)
+      setCachedPoint(*xT, x_dotT.get(), x_dotdotT.get(), curr_time);
+  }
+
   // W matrix
   if (Teuchos::nonnull(W_op_out_crsT)) {
     app->computeGlobalJacobianT(
         alpha, beta, omega, curr_time, x_dotT.get(), x_dotdotT.get(), *xT,
         sacado_param_vec, fT_out.get(), *W_op_out_crsT);
+    if (use_cache && Teuchos::nonnull(fT_out)) {
+      copyToCache(fT_out.get(), cache.f);
+      cache.f_valid = true;
+    }
     f_already_computed = true;
 #ifdef WRITE_MASS_MATRIX_TO_MM_FILE
     // IK, 4/24/15: write mass matrix to matrix market file
@@ -754,6 +1017,48 @@ Albany::ModelEvaluatorT::evalModelImpl(
         "colmap.mm", *Mass_crs->getColMap());
 #endif
   }
+  // Matrix-free W and its lagged, assembled preconditioner
+  if (Teuchos::nonnull(W_op_out_mfT)) {
+    W_op_out_mfT->set(
+        alpha, beta, omega, curr_time, x_dotT, x_dotdotT, xT,
+        sacado_param_vec);
+  }
+  if (Teuchos::nonnull(mf_jacobi) &&
+      outArgsT.supports(Thyra::ModelEvaluatorBase::OUT_ARG_W_prec) &&
+      Teuchos::nonnull(outArgsT.get_W_prec())) {
+    if (mf_prec_age % mf_prec_lag == 0) {
+      // Only the diagonal is scattered; no Jacobian is assembled
+      Tpetra_Vector diag(app->getMapT());
+      app->computeGlobalJacobianDiagonalT(
+          alpha, beta, omega, curr_time, x_dotT.get(), x_dotdotT.get(), *xT,
+          sacado_param_vec, diag);
+      mf_jacobi->setDiagonal(diag);
+    }
+    ++mf_prec_age;
+  }
+#ifdef ALBANY_IFPACK2
+  if (matrix_free && Teuchos::nonnull(mf_prec) &&
+      outArgsT.supports(Thyra::ModelEvaluatorBase::OUT_ARG_W_prec) &&
+      Teuchos::nonnull(outArgsT.get_W_prec())) {
+    if (mf_prec_age % mf_prec_lag == 0) {
+      app->computeGlobalJacobianT(
+          alpha, beta, omega, curr_time, x_dotT.get(), x_dotdotT.get(), *xT,
+          sacado_param_vec, NULL, *mf_prec_jac);
+      mf_prec->compute();
+    }
+    ++mf_prec_age;
+  }
+#endif
+  // Reused preconditioner, rebuilt from the last assembled W when the policy
+  // says so; the solver may ask for W_prec without W
+  if (Teuchos::nonnull(W_op_out_crsT)) prec_reuse_W = W_op_out_crsT;
+  if (Teuchos::nonnull(prec_reuse) &&
+      outArgsT.supports(Thyra::ModelEvaluatorBase::OUT_ARG_W_prec) &&
+      Teuchos::nonnull(outArgsT.get_W_prec()) &&
+      Teuchos::nonnull(prec_reuse_W)) {
+    prec_reuse->update(prec_reuse_W, curr_time);
+  }
+
   if (Teuchos::nonnull(WPrec_out)) {
     app->computeGlobalJacobianT(
         alpha, beta, omega, curr_time, x_dotT.get(), x_dotdotT.get(), *xT,
@@ -799,9 +1104,21 @@ Albany::ModelEvaluatorT::evalModelImpl(
         dummy_derivT);
   } else {
     if (Teuchos::nonnull(fT_out) && !f_already_computed) {
-      app->computeGlobalResidualT(
-          curr_time, x_dotT.get(), x_dotdotT.get(), *xT, sacado_param_vec,
-          *fT_out);
+      if (at_cached_point && cache.f_valid) {
+        Teuchos::TimeMonitor hitTimer(*cache_hit_timer);
+        fT_out->assign(*cache.f);
+      } else if (use_cache) {
+        Teuchos::TimeMonitor missTimer(*cache_miss_timer);
+        app->computeGlobalResidualT(
+            curr_time, x_dotT.get(), x_dotdotT.get(), *xT, sacado_param_vec,
+            *fT_out);
+        copyToCache(fT_out.get(), cache.f);
+        cache.f_valid = true;
+      } else {
+        app->computeGlobalResidualT(
+            curr_time, x_dotT.get(), x_dotdotT.get(), *xT, sacado_param_vec,
+            *fT_out);
+      }
     }
   }
 
@@ -12,9 +12,15 @@
 #include "Piro_TransientDecorator.hpp"
 
 #include "Albany_Application.hpp"
+#include "Albany_MatrixFreeJacobianOpT.hpp"
+#include "Albany_PreconditionerReuseT.hpp"
 
 #include "Teuchos_TimeMonitor.hpp"
 
+#ifdef ALBANY_IFPACK2
+#include "Ifpack2_Preconditioner.hpp"
+#endif
+
 namespace Albany {
 
 class ModelEvaluatorT
@@ -167,6 +173,77 @@ class ModelEvaluatorT
 
   //! Model uses time integration (accelerations)
   bool supports_xdotdot;
+
+  //! Whether f computed at a point is reused when the solver asks again at
+  //! the same point ("Cache Residual")
+  bool cache_results;
+
+  //! Last point at which f or W was computed, and what was computed there
+  struct ResultCache {
+    Teuchos::RCP<Tpetra_Vector> x, x_dot, x_dotdot;
+    bool has_x_dot, has_x_dotdot;
+    double time;
+    Teuchos::Array<Teuchos::Array<ST>> params;
+    int state_version;
+    int mesh_version;
+    bool valid;
+
+    //! Residual at the point, if computed
+    Teuchos::RCP<Tpetra_Vector> f;
+    bool f_valid;
+
+    ResultCache() : valid(false), f_valid(false) {}
+  };
+  mutable ResultCache cache;
+
+  //! Counts of cache hits and misses, reported with the other timers
+  Teuchos::RCP<Teuchos::Time> cache_hit_timer;
+  Teuchos::RCP<Teuchos::Time> cache_miss_timer;
+
+  //! Whether (x, x_dot, x_dotdot, t, p) is the cached point, on all ranks
+  bool
+  isCachedPoint(
+      const Tpetra_Vector& xT, const Tpetra_Vector* x_dotT,
+      const Tpetra_Vector* x_dotdotT, const double time) const;
+
+  //! Make (x, x_dot, x_dotdot, t, p) the cached point, with nothing computed
+  void
+  setCachedPoint(
+      const Tpetra_Vector& xT, const Tpetra_Vector* x_dotT,
+      const Tpetra_Vector* x_dotdotT, const double time) const;
+
+  //! W is applied through Tangent fills instead of being assembled
+  //! ("Matrix-Free Jacobian")
+  bool matrix_free;
+
+  //! Preconditioner type for the matrix-free W: "Jacobi", "None", or an
+  //! Ifpack2 type
+  std::string mf_prec_type;
+
+  //! Parameters of the matrix-free W preconditioner
+  Teuchos::RCP<Teuchos::ParameterList> mf_prec_params;
+
+  //! The preconditioner is rebuilt from the Jacobian, or only its diagonal
+  //! for Jacobi, every mf_prec_lag requests for W_prec
+  int mf_prec_lag;
+  mutable int mf_prec_age;
+
+  //! Jacobi preconditioner; keeps only the Jacobian diagonal
+  mutable Teuchos::RCP<Albany::MatrixFreeJacobiPrecT> mf_jacobi;
+
+  //! Assembled Jacobian an Ifpack2 preconditioner is built from
+  mutable Teuchos::RCP<Tpetra_CrsMatrix> mf_prec_jac;
+
+#ifdef ALBANY_IFPACK2
+  mutable Teuchos::RCP<Ifpack2::Preconditioner<ST, LO, GO, KokkosNode>>
+      mf_prec;
+#endif
+
+  //! Stratimikos preconditioner kept across Jacobians ("Preconditioner Reuse")
+  Teuchos::RCP<Albany::PreconditionerReuseT> prec_reuse;
+
+  //! Last assembled W, which the reused preconditioner is rebuilt from
+  mutable Teuchos::RCP<const Tpetra_CrsMatrix> prec_reuse_W;
 };
 }
 
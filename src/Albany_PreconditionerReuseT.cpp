@@ -0,0 +1,154 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_PreconditionerReuseT.hpp"
+
+#include "Teuchos_TestForException.hpp"
+#include "Teuchos_TimeMonitor.hpp"
+#include "Teuchos_VerboseObject.hpp"
+
+#include "Thyra_DefaultLinearOpSource.hpp"
+#include "Thyra_DefaultPreconditioner.hpp"
+#include "Thyra_TpetraThyraWrappers.hpp"
+
+Albany::PreconditionerReuseT::PreconditionerReuseT(
+    const Teuchos::ParameterList& reuseParams,
+    const Teuchos::RCP<Thyra::PreconditionerFactoryBase<ST>>& factory_)
+    : factory(factory_),
+      max_uses(reuseParams.get("Max Uses", 0)),
+      max_steps(reuseParams.get("Max Time Steps", 0)),
+      max_linear_iterations(reuseParams.get("Max Linear Iterations", 0)),
+      keep_symbolic(reuseParams.get("Keep Symbolic Setup", true)),
+      num_uses(0),
+      num_steps(0),
+      last_time(0.0),
+      setup_W(NULL),
+      num_setups(0),
+      last_apply_time(0.0) {
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      Teuchos::is_null(factory), Teuchos::Exceptions::InvalidParameter,
+      std::endl
+          << "Error!  In Albany::PreconditionerReuseT constructor:  "
+          << "Preconditioner Reuse needs a Stratimikos Preconditioner Type"
+          << std::endl);
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      max_uses < 0 || max_steps < 0 || max_linear_iterations < 0,
+      Teuchos::Exceptions::InvalidParameter,
+      std::endl
+          << "Error!  In Albany::PreconditionerReuseT constructor:  "
+          << "Preconditioner Reuse limits cannot be negative" << std::endl);
+
+  setup_timer = Teuchos::TimeMonitor::getNewTimer("Albany: Preconditioner Setup");
+  apply_timer = Teuchos::TimeMonitor::getNewTimer("Albany: Preconditioner Apply");
+  prec_op = Teuchos::rcp(new CountingOp(apply_timer));
+  out = Teuchos::VerboseObjectBase::getDefaultOStream();
+}
+
+Teuchos::RCP<const Teuchos::ParameterList>
+Albany::PreconditionerReuseT::getValidParameters() {
+  Teuchos::RCP<Teuchos::ParameterList> validPL =
+      Teuchos::rcp(new Teuchos::ParameterList("Valid Preconditioner Reuse Params"));
+  validPL->set<bool>("Enable", false,
+      "Let the model evaluator build the Stratimikos preconditioner and keep it across Jacobians");
+  validPL->set<int>("Max Uses", 0,
+      "Rebuild after this many Jacobians (Newton iterations); 0 for no limit");
+  validPL->set<int>("Max Time Steps", 0,
+      "Rebuild after this many time steps; 0 for no limit");
+  validPL->set<int>("Max Linear Iterations", 0,
+      "Rebuild when the last linear solve applied the preconditioner more than this many times; 0 for no limit");
+  validPL->set<bool>("Keep Symbolic Setup", true,
+      "Pass the old preconditioner back to the factory on a rebuild, so it can keep its symbolic setup");
+  return validPL;
+}
+
+Teuchos::RCP<Thyra::PreconditionerBase<ST>>
+Albany::PreconditionerReuseT::createPrec() {
+  const Teuchos::RCP<Thyra::DefaultPreconditioner<ST>> W_prec =
+      Teuchos::rcp(new Thyra::DefaultPreconditioner<ST>);
+  W_prec->initializeUnspecified(prec_op);
+  return W_prec;
+}
+
+bool
+Albany::PreconditionerReuseT::needsSetup(const Tpetra_CrsMatrix* W) const {
+  // Never built, or built for another matrix (e.g., after adaptation)
+  if (num_setups == 0 || W != setup_W) return true;
+  if (max_uses == 0 && max_steps == 0 && max_linear_iterations == 0)
+    return true;
+  if (max_uses > 0 && num_uses >= max_uses) return true;
+  if (max_steps > 0 && num_steps >= max_steps) return true;
+  if (max_linear_iterations > 0 &&
+      prec_op->numApplies() > max_linear_iterations)
+    return true;
+  return false;
+}
+
+void
+Albany::PreconditionerReuseT::update(
+    const Teuchos::RCP<const Tpetra_CrsMatrix>& W, const double time) {
+  if (num_setups > 0 && time != last_time) ++num_steps;
+  last_time = time;
+
+  // What the linear solve since the last update cost
+  const int applies = prec_op->numApplies();
+  const double apply_time = apply_timer->totalElapsedTime() - last_apply_time;
+
+  const bool setup = needsSetup(W.get());
+  double setup_time = 0.0;
+  if (setup) {
+    const double start = setup_timer->totalElapsedTime();
+    {
+      Teuchos::TimeMonitor setupTimer(*setup_timer);
+      if (Teuchos::is_null(prec) || !keep_symbolic)
+        prec = factory->createPrec();
+      const Teuchos::RCP<const Tpetra_Operator> W_op = W;
+      factory->initializePrec(
+          Thyra::defaultLinearOpSource<ST>(
+              Thyra::createConstLinearOp<ST, LO, GO, KokkosNode>(W_op)),
+          prec.ptr());
+    }
+    setup_time = setup_timer->totalElapsedTime() - start;
+
+    prec_op->setOp(
+        Teuchos::nonnull(prec->getUnspecifiedPrecOp())
+            ? prec->getUnspecifiedPrecOp()
+            : prec->getRightPrecOp());
+    setup_W = W.get();
+    num_uses = 0;
+    num_steps = 0;
+    ++num_setups;
+  }
+  ++num_uses;
+
+  if (num_setups > 1 || !setup)
+    *out << "Preconditioner: last linear solve applied it " << applies
+         << " times in " << apply_time << " s; ";
+  else
+    *out << "Preconditioner: ";
+  if (setup)
+    *out << "rebuilt in " << setup_time << " s" << std::endl;
+  else
+    *out << "reused (Jacobian " << num_uses << " since setup)" << std::endl;
+
+  prec_op->resetApplies();
+  last_apply_time = apply_timer->totalElapsedTime();
+}
+
+bool
+Albany::PreconditionerReuseT::CountingOp::opSupportedImpl(
+    Thyra::EOpTransp M_trans) const {
+  return Teuchos::nonnull(op) && Thyra::opSupported(*op, M_trans);
+}
+
+void
+Albany::PreconditionerReuseT::CountingOp::applyImpl(
+    const Thyra::EOpTransp M_trans, const Thyra::MultiVectorBase<ST>& X,
+    const Teuchos::Ptr<Thyra::MultiVectorBase<ST>>& Y, const ST alpha,
+    const ST beta) const {
+  Teuchos::TimeMonitor applyTimer(*timer);
+  ++num_applies;
+  Thyra::apply(*op, M_trans, X, Y, alpha, beta);
+}
@@ -0,0 +1,145 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_PRECONDITIONER_REUSE_T_HPP
+#define ALBANY_PRECONDITIONER_REUSE_T_HPP
+
+#include "Albany_DataTypes.hpp"
+
+#include "Teuchos_FancyOStream.hpp"
+#include "Teuchos_ParameterList.hpp"
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_Time.hpp"
+
+#include "Thyra_LinearOpDefaultBase.hpp"
+#include "Thyra_PreconditionerBase.hpp"
+#include "Thyra_PreconditionerFactoryBase.hpp"
+
+namespace Albany {
+
+//! Preconditioner built by a Thyra factory and kept across Jacobians
+/*!
+ * The model evaluator hands the solver the preconditioner returned by
+ * createPrec() and calls update() on every request for W_prec, with the
+ * Jacobian just assembled. update() rebuilds the preconditioner from that
+ * Jacobian only when one of the limits of the "Preconditioner Reuse" list
+ * is reached; otherwise the solver keeps using the one it has.
+ *
+ * A rebuild passes the existing preconditioner back to the factory, so
+ * factories that support it (MueLu with "reuse: type") only refresh the
+ * numeric setup. "Keep Symbolic Setup" = false starts every rebuild over.
+ *
+ * Setup and apply times are accumulated in the "Albany: Preconditioner
+ * Setup" and "Albany: Preconditioner Apply" timers, and each update()
+ * reports them for the linear solve since the previous one.
+ */
+class PreconditionerReuseT {
+ public:
+  PreconditionerReuseT(
+      const Teuchos::ParameterList& reuseParams,
+      const Teuchos::RCP<Thyra::PreconditionerFactoryBase<ST>>& factory);
+
+  //! Valid entries of the "Preconditioner Reuse" list
+  static Teuchos::RCP<const Teuchos::ParameterList>
+  getValidParameters();
+
+  //! Preconditioner to hand to the solver; the same object for the whole run
+  Teuchos::RCP<Thyra::PreconditionerBase<ST>>
+  createPrec();
+
+  //! Rebuild the preconditioner from W if the reuse policy says so
+  void
+  update(const Teuchos::RCP<const Tpetra_CrsMatrix>& W, const double time);
+
+  //! Number of times the preconditioner has been (re)built
+  int
+  numSetups() const {
+    return num_setups;
+  }
+
+ private:
+  //! Applies the factory's preconditioner, counting and timing the applies
+  class CountingOp : public Thyra::LinearOpDefaultBase<ST> {
+   public:
+    explicit CountingOp(const Teuchos::RCP<Teuchos::Time>& timer_) :
+        timer(timer_), num_applies(0) {}
+
+    void
+    setOp(const Teuchos::RCP<const Thyra::LinearOpBase<ST>>& op_) {
+      op = op_;
+    }
+
+    Teuchos::RCP<const Thyra::VectorSpaceBase<ST>>
+    range() const {
+      return Teuchos::nonnull(op) ? op->range() : Teuchos::null;
+    }
+
+    Teuchos::RCP<const Thyra::VectorSpaceBase<ST>>
+    domain() const {
+      return Teuchos::nonnull(op) ? op->domain() : Teuchos::null;
+    }
+
+    //! Applies since the last resetApplies()
+    int
+    numApplies() const {
+      return num_applies;
+    }
+
+    void
+    resetApplies() {
+      num_applies = 0;
+    }
+
+   protected:
+    bool
+    opSupportedImpl(Thyra::EOpTransp M_trans) const;
+
+    void
+    applyImpl(
+        const Thyra::EOpTransp M_trans, const Thyra::MultiVectorBase<ST>& X,
+        const Teuchos::Ptr<Thyra::MultiVectorBase<ST>>& Y, const ST alpha,
+        const ST beta) const;
+
+   private:
+    Teuchos::RCP<const Thyra::LinearOpBase<ST>> op;
+    Teuchos::RCP<Teuchos::Time> timer;
+    mutable int num_applies;
+  };
+
+  //! Whether the limits call for a rebuild from W
+  bool
+  needsSetup(const Tpetra_CrsMatrix* W) const;
+
+  Teuchos::RCP<Thyra::PreconditionerFactoryBase<ST>> factory;
+
+  //! Preconditioner built by the factory, and what the solver sees of it
+  Teuchos::RCP<Thyra::PreconditionerBase<ST>> prec;
+  Teuchos::RCP<CountingOp> prec_op;
+
+  //! Limits; 0 means no limit
+  int max_uses;
+  int max_steps;
+  int max_linear_iterations;
+  bool keep_symbolic;
+
+  //! Jacobians and time steps since the last setup
+  int num_uses;
+  int num_steps;
+  double last_time;
+  const Tpetra_CrsMatrix* setup_W;
+
+  int num_setups;
+
+  Teuchos::RCP<Teuchos::Time> setup_timer;
+  Teuchos::RCP<Teuchos::Time> apply_timer;
+  double last_apply_time;
+
+  Teuchos::RCP<Teuchos::FancyOStream> out;
+};
+
+}  // namespace Albany
+
+#endif  // ALBANY_PRECONDITIONER_REUSE_T_HPP
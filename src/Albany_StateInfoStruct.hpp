@@ -36,6 +36,10 @@ typedef shards::Array<double, shards::NaturalOrder> MDArray;
 typedef shards::Array<LO, shards::NaturalOrder> IDArray;
 typedef std::map< std::string, MDArray > StateArray;
 typedef std::vector<StateArray> StateArrayVec;
+//! Integer handles of the element states, assigned once by the StateManager
+typedef std::map< std::string, int > StateHandles;
+//! Element states of one workset indexed by handle
+typedef std::vector<MDArray> StateHandleArray;
 
   struct StateArrays {
     StateArrayVec elemStateArrays;
@@ -12,8 +12,32 @@
 #include "Teuchos_TestForException.hpp"
 #include "Teuchos_VerboseObject.hpp"
 
+#include <algorithm>
+
+namespace {
+// Copy state name into its twin name_old in every workset that has both.
+// The arrays are views of contiguous field data, so each workset is one
+// bulk copy, and the map is searched once per workset, not per value.
+void copyToOldState(
+    Albany::StateArrayVec& sav,
+    const std::string&     name,
+    const std::string&     name_old)
+{
+  for (std::size_t ws = 0; ws < sav.size(); ws++) {
+    Albany::StateArray&                sa     = sav[ws];
+    const Albany::StateArray::iterator it     = sa.find(name);
+    const Albany::StateArray::iterator it_old = sa.find(name_old);
+    if (it == sa.end() || it_old == sa.end()) continue;
+    const double* src = it->second.contiguous_data();
+    std::copy(src, src + it->second.size(), it_old->second.contiguous_data());
+  }
+}
+}  // namespace
+
 Albany::StateManager::StateManager()
-    : stateVarsAreAllocated(false), stateInfo(Teuchos::rcp(new StateInfoStruct))
+    : stateVarsAreAllocated(false),
+      stateVersion(0),
+      stateInfo(Teuchos::rcp(new StateInfoStruct))
 {
   // Nothing to be done here
 }
@@ -664,6 +688,9 @@ Albany::StateManager::setStateArrays(
 
   doSetStateArrays(disc, stateInfo);
 
+  for (unsigned int i = 0; i < stateInfo->size(); i++)
+    stateHandles[(*stateInfo)[i]->name] = i;
+
   // First, we check the explicitly required side discretizations exist...
   const auto& ss_discs = disc->getSideSetDiscretizations();
   for (auto const& it : sideSetStateInfo) {
@@ -852,6 +879,38 @@ Albany::StateManager::getStateArray(SAType type, const int ws) const
   }
 }
 
+const Albany::StateHandleArray&
+Albany::StateManager::getStateHandleArray(const int ws) const
+{
+  TEUCHOS_TEST_FOR_EXCEPT(!stateVarsAreAllocated);
+
+  // Rebuilt from the state maps whenever the discretization may have rebuilt
+  // them. Discretizations without a mesh version rebuild it on every call,
+  // which costs one map search per state and workset, as the evaluators did.
+  std::lock_guard<std::mutex> lock(stateHandleMutex);
+
+  const Albany::StateArrayVec& esa         = getStateArrays().elemStateArrays;
+  const int                    meshVersion = disc->getMeshVersion();
+  if (stateHandleArrays.size() != esa.size()) {
+    stateHandleArrays.assign(esa.size(), StateHandleArray());
+    stateHandleArraysMeshVersion.assign(esa.size(), -1);
+  }
+
+  if (meshVersion < 0 || stateHandleArraysMeshVersion[ws] != meshVersion) {
+    StateHandleArray& sha = stateHandleArrays[ws];
+    sha.assign(stateInfo->size(), MDArray());
+    for (StateHandles::const_iterator it = stateHandles.begin();
+         it != stateHandles.end();
+         ++it) {
+      const StateArray::const_iterator s = esa[ws].find(it->first);
+      if (s != esa[ws].end()) sha[it->second] = s->second;
+    }
+    stateHandleArraysMeshVersion[ws] = meshVersion;
+  }
+
+  return stateHandleArrays[ws];
+}
+
 Albany::StateArrays&
 Albany::StateManager::getStateArrays() const
 {
@@ -865,15 +924,14 @@ Albany::StateManager::updateStates()
   // Swap boolean that defines old and new (in terms of state1 and 2) in
   // accessors
   TEUCHOS_TEST_FOR_EXCEPT(!stateVarsAreAllocated);
+  ++stateVersion;
 
   // Get states from STK mesh
   Albany::StateArrays&   sa              = disc->getStateArrays();
   Albany::StateArrayVec& esa             = sa.elemStateArrays;
   Albany::StateArrayVec& nsa             = sa.nodeStateArrays;
-  int                    numElemWorksets = esa.size();
-  int                    numNodeWorksets = nsa.size();
 
-  // For each workset, loop over registered states
+  // For each registered state, copy it to its old state in every workset
 
   for (unsigned int i = 0; i < stateInfo->size(); i++) {
     if ((*stateInfo)[i]->saveOldState) {
@@ -882,26 +940,20 @@ Albany::StateManager::updateStates()
 
       switch ((*stateInfo)[i]->entity) {
         case Albany::StateStruct::NodalDataToElemNode:
-          for (int ws = 0; ws < numNodeWorksets; ws++)
-            for (int j                  = 0; j < nsa[ws][stateName].size(); j++)
-              nsa[ws][stateName_old][j] = nsa[ws][stateName][j];
+          copyToOldState(nsa, stateName, stateName_old);
 
         case Albany::StateStruct::WorksetValue:
         case Albany::StateStruct::ElemData:
         case Albany::StateStruct::QuadPoint:
         case Albany::StateStruct::ElemNode:
 
-          for (int ws = 0; ws < numElemWorksets; ws++)
-            for (int j                  = 0; j < esa[ws][stateName].size(); j++)
-              esa[ws][stateName_old][j] = esa[ws][stateName][j];
+          copyToOldState(esa, stateName, stateName_old);
 
           break;
 
         case Albany::StateStruct::NodalData:
 
-          for (int ws = 0; ws < numNodeWorksets; ws++)
-            for (int j                  = 0; j < nsa[ws][stateName].size(); j++)
-              nsa[ws][stateName_old][j] = nsa[ws][stateName][j];
+          copyToOldState(nsa, stateName, stateName_old);
 
           break;
 
@@ -930,6 +982,7 @@ Albany::StateManager::setEigenData(
     const Teuchos::RCP<Albany::EigendataStruct>& eigdata)
 {
   eigenData = eigdata;
+  ++stateVersion;
 }
 
 Teuchos::RCP<Epetra_MultiVector>
@@ -949,6 +1002,7 @@ Albany::StateManager::setAuxData(
     const Teuchos::RCP<Epetra_MultiVector>& aux_data)
 {
   auxData = aux_data;
+  ++stateVersion;
 }
 
 #endif
@@ -958,6 +1012,7 @@ Albany::StateManager::setAuxDataT(
     const Teuchos::RCP<Tpetra_MultiVector>& aux_data)
 {
   auxDataT = aux_data;
+  ++stateVersion;
 }
 
 void
@@ -965,6 +1020,7 @@ Albany::StateManager::setEigenDataT(
     const Teuchos::RCP<Albany::EigendataStructT>& eigdata)
 {
   eigenDataT = eigdata;
+  ++stateVersion;
 }
 
 std::vector<std::string>
@@ -11,6 +11,7 @@
 #define ALBANY_STATEMANAGER_HPP
 
 #include <map>
+#include <mutex>
 #include <string>
 #include <vector>
 #include "Albany_AbstractDiscretization.hpp"
@@ -257,6 +258,26 @@ class StateManager {
     return stateVarsAreAllocated;
   }
 
+  //! Handles of the element states, assigned when the state arrays are set
+  const StateHandles&
+  getStateHandles() const
+  {
+    return stateHandles;
+  }
+
+  //! Element states of workset ws indexed by handle; a state the workset
+  //! does not have is an empty (rank 0) array
+  const StateHandleArray&
+  getStateHandleArray(const int ws) const;
+
+  //! Counter bumped whenever the old states, eigen data or aux data change,
+  //! i.e. whenever the residual at a given solution may change
+  int
+  getStateVersion() const
+  {
+    return stateVersion;
+  }
+
  private:
   //! Private to prohibit copying
   StateManager(const StateManager&);
@@ -276,6 +297,15 @@ class StateManager {
   //! and befor gets
   bool stateVarsAreAllocated;
 
+  //! See getStateVersion()
+  int stateVersion;
+
+  //! See getStateHandles() and getStateHandleArray()
+  StateHandles                          stateHandles;
+  mutable std::vector<StateHandleArray> stateHandleArrays;
+  mutable std::vector<int>              stateHandleArraysMeshVersion;
+  mutable std::mutex                    stateHandleMutex;
+
   //! Container to hold the states that have been registered, by element block,
   //! to be allocated later
   std::map<std::string, RegisteredStates> statesToStore;
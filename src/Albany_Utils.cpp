@@ -519,6 +519,18 @@
     safe_system("sleep 10");
   }
 
+  void Albany::initializeMPIThreads(int* argc, char*** argv) {
+#ifdef ALBANY_MPI
+    int initialized = 0;
+    MPI_Initialized(&initialized);
+    if (!initialized) {
+      // MPI may provide less; asynchronous output checks what it got
+      int provided = MPI_THREAD_SINGLE;
+      MPI_Init_thread(argc, argv, MPI_THREAD_MULTIPLE, &provided);
+    }
+#endif
+  }
+
   void Albany::do_stack_trace() {
 
         void* callstack[128];
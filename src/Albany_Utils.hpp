@@ -238,6 +238,12 @@ struct CmdLineArgs {
 void
 connect_vtune(const int p_rank);
 
+// Initialize MPI asking for MPI_THREAD_MULTIPLE, so that asynchronous Exodus
+// output may call MPI from its writer thread. Call before creating the
+// Teuchos::GlobalMPISession, which leaves an initialized MPI as is.
+void
+initializeMPIThreads(int* argc, char*** argv);
+
 // Do a nice stack trace for debugging
 void
 do_stack_trace();
@@ -0,0 +1,136 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_WorksetThreads.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
+#include "Phalanx_KokkosDeviceTypes.hpp"
+#include "Teuchos_ConfigDefs.hpp"
+#include "Teuchos_TestForException.hpp"
+
+void
+Albany::checkWorksetThreadsSupported(int const num_threads)
+{
+  if (num_threads == 1) return;
+
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+  bool const
+  atomic_rcp = true;
+#else
+  bool const
+  atomic_rcp = false;
+#endif
+  TEUCHOS_TEST_FOR_EXCEPTION(!atomic_rcp, std::logic_error,
+      "Error in Albany::Application: Workset Threads > 1 needs Teuchos "
+      "reference counts that are thread safe; configure Trilinos with "
+      "Trilinos_ENABLE_THREAD_SAFE=ON or set Workset Threads to 1.\n");
+
+#ifdef KOKKOS_HAVE_SERIAL
+  bool const
+  serial_space = std::is_same<PHX::Device::execution_space, Kokkos::Serial>::value;
+#else
+  bool const
+  serial_space = false;
+#endif
+  // Evaluator kernels are RangePolicy parallel_for, which Serial runs as a
+  // plain loop; only the team kernels use its shared scratch memory
+#ifdef KOKKOS_OPTIMIZED
+  bool const
+  team_kernels = true;
+#else
+  bool const
+  team_kernels = false;
+#endif
+  TEUCHOS_TEST_FOR_EXCEPTION(!serial_space || team_kernels,
+      std::logic_error,
+      "Error in Albany::Application: Workset Threads > 1 launches evaluators "
+      "from several threads at once, which Kokkos only allows on the Serial "
+      "back end with evaluators built without KOKKOS_OPTIMIZED. Set Workset "
+      "Threads to 1, and use Kokkos OpenMP to thread the cell loops "
+      "instead.\n");
+}
+
+void
+Albany::colorWorksets(
+    AbstractDiscretization::Conn const& wsElNodeEqID,
+    Teuchos::Array<Teuchos::Array<int>>& colors)
+{
+  // One bit per color already used by a workset touching the row. Worksets
+  // that conflict with all 64 colors are put in colors of their own.
+  int const
+  max_colors = 64;
+
+  int const
+  num_ws = wsElNodeEqID.size();
+
+  LO
+  num_rows = 0;
+
+  for (int ws = 0; ws < num_ws; ++ws) {
+    auto const& conn = wsElNodeEqID[ws];
+    for (int cell = 0; cell < conn.dimension(0); ++cell) {
+      for (int node = 0; node < conn.dimension(1); ++node) {
+        for (int eq = 0; eq < conn.dimension(2); ++eq) {
+          num_rows = std::max(num_rows, conn(cell, node, eq) + 1);
+        }
+      }
+    }
+  }
+
+  std::vector<std::uint64_t>
+  row_colors(num_rows, 0);
+
+  colors.clear();
+  colors.resize(max_colors);
+
+  Teuchos::Array<Teuchos::Array<int>>
+  overflow;
+
+  for (int ws = 0; ws < num_ws; ++ws) {
+    auto const& conn = wsElNodeEqID[ws];
+
+    std::uint64_t
+    used = 0;
+
+    for (int cell = 0; cell < conn.dimension(0); ++cell) {
+      for (int node = 0; node < conn.dimension(1); ++node) {
+        for (int eq = 0; eq < conn.dimension(2); ++eq) {
+          used |= row_colors[conn(cell, node, eq)];
+        }
+      }
+    }
+
+    if (~used == 0) {
+      overflow.push_back(Teuchos::Array<int>(1, ws));
+      continue;
+    }
+
+    int
+    color = 0;
+
+    while ((used >> color) & 1) ++color;
+
+    colors[color].push_back(ws);
+
+    std::uint64_t const
+    bit = std::uint64_t(1) << color;
+
+    for (int cell = 0; cell < conn.dimension(0); ++cell) {
+      for (int node = 0; node < conn.dimension(1); ++node) {
+        for (int eq = 0; eq < conn.dimension(2); ++eq) {
+          row_colors[conn(cell, node, eq)] |= bit;
+        }
+      }
+    }
+  }
+
+  while (colors.size() > 0 && colors.back().size() == 0) colors.pop_back();
+
+  colors.insert(colors.end(), overflow.begin(), overflow.end());
+}
@@ -0,0 +1,84 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_WORKSET_THREADS_HPP
+#define ALBANY_WORKSET_THREADS_HPP
+
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Albany_AbstractDiscretization.hpp"
+#include "Teuchos_Array.hpp"
+
+namespace Albany {
+
+//! Greedy coloring of the worksets of a discretization.
+//
+// Two worksets receive different colors whenever they share an overlapped
+// equation (a row of the overlapped residual/Jacobian). Worksets of the same
+// color can therefore be scattered concurrently without write conflicts.
+// Colors are returned as lists of workset indices, in increasing order.
+void
+colorWorksets(
+    AbstractDiscretization::Conn const& wsElNodeEqID,
+    Teuchos::Array<Teuchos::Array<int>>& colors);
+
+//! Throw unless worksets can be evaluated on several host threads.
+//
+// Each thread runs whole field managers, so nothing they call may rely on
+// being alone in the process. This holds only when Teuchos reference counts
+// are atomic (Trilinos_ENABLE_THREAD_SAFE) and when Kokkos runs on the Serial
+// back end, whose range kernels keep no shared state. The team kernels of
+// KOKKOS_OPTIMIZED share the Serial scratch memory and are excluded. Other
+// builds should use Kokkos OpenMP instead, which threads the cell loops of
+// each evaluator.
+void
+checkWorksetThreadsSupported(int const num_threads);
+
+//! Run f(thread) on threads 0..num_threads-1.
+//
+// The calling thread takes part as thread 0. The first exception thrown by
+// any thread is rethrown on the calling thread once all threads have joined.
+template <typename F>
+void
+parallelForThreads(int const num_threads, F const& f)
+{
+  std::exception_ptr
+  error;
+
+  std::mutex
+  error_mutex;
+
+  auto worker = [&](int const thread) {
+    try {
+      f(thread);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(error_mutex);
+      if (!error) error = std::current_exception();
+    }
+  };
+
+  std::vector<std::thread>
+  threads;
+
+  for (int t = 1; t < num_threads; ++t) {
+    threads.emplace_back(worker, t);
+  }
+
+  worker(0);
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  if (error) std::rethrow_exception(error);
+}
+
+} // namespace Albany
+
+#endif // ALBANY_WORKSET_THREADS_HPP
@@ -275,6 +275,13 @@ evaluateFields(typename Traits::EvalData workset)
   int numDim = 0;
   if (this->tensorRank==2) numDim = this->valTensor.dimension(2);
 
+  // Element-local columns can use the precomputed offsets; the extruded
+  // columns below are outside the element and still go through the search
+  const auto& jacOffsets = workset.wsJacOffsets;
+  const bool useOffsets = jacOffsets.size() != 0;
+  Tpetra_CrsMatrix::local_matrix_type::values_type JacT_values;
+  if (useOffsets) JacT_values = JacT->getLocalMatrix().values;
+
   for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
     // Local Unks: Loop over nodes in element, Loop over equations per node
     for (unsigned int node_col(0), i(0); node_col<this->numNodes; node_col++){
@@ -296,7 +303,15 @@ evaluateFields(typename Traits::EvalData workset)
           if (loadResid)
             fT->sumIntoLocalValue(rowT, valptr.val());
           // Check derivative array is nonzero
-          if (valptr.hasFastAccess()) {
+          if (valptr.hasFastAccess() && useOffsets) {
+            const int row_unk = neq*node + this->offset + eq;
+            for (unsigned int lunk = 0; lunk < nunk; lunk++) {
+              const LO off = workset.is_adjoint ?
+                jacOffsets(cell,index[lunk],row_unk) : jacOffsets(cell,row_unk,index[lunk]);
+              if (off >= 0) JacT_values(off) += valptr.fastAccessDx(index[lunk]);
+            }
+          }
+          else if (valptr.hasFastAccess()) {
             if (workset.is_adjoint) {
               // Sum Jacobian transposed
               for (unsigned int lunk = 0; lunk < nunk; lunk++) {
@@ -20,6 +20,7 @@
 #include "Sacado_ParameterAccessor.hpp"
 #include "PHAL_AlbanyTraits.hpp"
 #include "PHAL_Dirichlet.hpp"
+#include "SchwarzPointCache.hpp"
 
 #if defined(ALBANY_DTK)
 #include "DTK_STKMeshHelpers.hpp"
@@ -138,6 +139,9 @@ protected:
 
   int
   coupled_app_index_;
+
+  SchwarzPointCache
+  point_cache_;
 };
 
 //
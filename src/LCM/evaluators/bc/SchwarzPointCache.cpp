@@ -0,0 +1,570 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+
+#include "Albany_Application.hpp"
+#include "Albany_GenericSTKMeshStruct.hpp"
+#include "Albany_STKDiscretization.hpp"
+#include "Albany_Utils.hpp"
+#include "Intrepid2_CellTools.hpp"
+#include "Intrepid2_HGRAD_HEX_C1_FEM.hpp"
+#include "Intrepid2_HGRAD_TET_C1_FEM.hpp"
+#include "SchwarzPointCache.hpp"
+
+namespace LCM {
+
+namespace {
+
+// This tolerance is used for geometric approximations. It will be used
+// to determine whether a node of this_app is inside an element of
+// coupled_app within that tolerance.
+double const
+tolerance = 5.0e-2;
+
+// Maximum number of elements in a leaf of the hierarchy
+int const
+leaf_size = 8;
+
+bool
+inBox(std::array<double, 6> const & box, double const * const point, int dim)
+{
+  for (auto i = 0; i < dim; ++i) {
+    if (point[i] < box[i] || box[3 + i] < point[i]) return false;
+  }
+  return true;
+}
+
+} // anonymous namespace
+
+//
+//
+//
+void
+SchwarzPointCache::
+update(
+    Albany::Application const & this_app,
+    Albany::Application const & coupled_app,
+    int const coupled_app_index)
+{
+  auto const *
+  this_disc = static_cast<Albany::STKDiscretization const *>(
+      this_app.getDiscretization().get());
+
+  auto const *
+  coupled_disc = static_cast<Albany::STKDiscretization const *>(
+      coupled_app.getDiscretization().get());
+
+  bool const
+  is_current =
+      this_disc == this_disc_ &&
+      coupled_disc == coupled_disc_ &&
+      this_disc->getMeshVersion() == this_version_ &&
+      coupled_disc->getMeshVersion() == coupled_version_;
+
+  if (is_current == true) return;
+
+  build(this_app, coupled_app, coupled_app_index);
+
+  this_disc_ = this_disc;
+  coupled_disc_ = coupled_disc;
+  this_version_ = this_disc->getMeshVersion();
+  coupled_version_ = coupled_disc->getMeshVersion();
+}
+
+//
+//
+//
+void
+SchwarzPointCache::
+build(
+    Albany::Application const & this_app,
+    Albany::Application const & coupled_app,
+    int const coupled_app_index)
+{
+  Teuchos::RCP<Albany::AbstractDiscretization>
+  this_disc = this_app.getDiscretization();
+
+  auto *
+  this_stk_disc = static_cast<Albany::STKDiscretization *>(this_disc.get());
+
+  Teuchos::RCP<Albany::AbstractDiscretization>
+  coupled_disc = coupled_app.getDiscretization();
+
+  auto *
+  coupled_stk_disc =
+      static_cast<Albany::STKDiscretization *>(coupled_disc.get());
+
+  auto &
+  coupled_gms = dynamic_cast<Albany::GenericSTKMeshStruct &>
+      (*(coupled_stk_disc->getSTKMeshStruct()));
+
+  auto const &
+  coupled_ws_eb_names = coupled_disc->getWsEBNames();
+
+  Teuchos::ArrayRCP<Teuchos::RCP<Albany::MeshSpecsStruct>>
+  coupled_mesh_specs = coupled_gms.getMeshSpecs();
+
+  // Get cell topology of the application and block to which this node set
+  // is coupled.
+  std::string const &
+  this_app_name = this_app.getAppName();
+
+  std::string const &
+  coupled_app_name = coupled_app.getAppName();
+
+  std::string const
+  coupled_block_name = this_app.getCoupledBlockName(coupled_app_index);
+
+  bool const
+  use_block = coupled_block_name != "NONE";
+
+  std::map<std::string, int> const &
+  coupled_block_name_to_index = coupled_gms.ebNameToIndex;
+
+  auto
+  it = coupled_block_name_to_index.find(coupled_block_name);
+
+  bool const
+  missing_block = it == coupled_block_name_to_index.end();
+
+  if (use_block == true && missing_block == true) {
+    std::cerr << "\nERROR: " << __PRETTY_FUNCTION__ << '\n';
+    std::cerr << "Unknown coupled block: " << coupled_block_name << '\n';
+    std::cerr << "Coupling application : " << this_app_name << '\n';
+    std::cerr << "To application       : " << coupled_app_name << '\n';
+    exit(1);
+  }
+
+  // When ignoring the block, set the index to zero to get defaults
+  // corresponding to the first block.
+  auto const
+  coupled_block_index = use_block == true ? it->second : 0;
+
+  // The topology keeps a pointer to the data, so refer to the mesh specs
+  // rather than to a local copy.
+  CellTopologyData const &
+  coupled_cell_topology_data = coupled_mesh_specs[coupled_block_index]->ctd;
+
+  cell_topology_ =
+      Teuchos::rcp(new shards::CellTopology(&coupled_cell_topology_data));
+
+  dimension_ = coupled_cell_topology_data.dimension;
+
+  node_count_ = coupled_cell_topology_data.node_count;
+
+  auto const
+  parametric_dimension = dimension_;
+
+  auto const
+  coupled_vertex_count = coupled_cell_topology_data.vertex_count;
+
+  auto const
+  coupled_element_type =
+        minitensor::find_type(dimension_, coupled_vertex_count);
+
+  lo_ = minitensor::Vector<double>(
+      parametric_dimension, minitensor::Filler::ONES);
+
+  hi_ = minitensor::Vector<double>(
+      parametric_dimension, minitensor::Filler::ONES);
+
+  hi_ = hi_ * (1.0 + tolerance);
+
+  switch (coupled_element_type) {
+
+  default:
+    MT_ERROR_EXIT("Unknown element type");
+    break;
+
+  case minitensor::ELEMENT::TETRAHEDRAL:
+    basis_ = Teuchos::rcp(new Intrepid2::Basis_HGRAD_TET_C1_FEM<PHX::Device>());
+    lo_ = - tolerance * lo_;
+    break;
+
+  case minitensor::ELEMENT::HEXAHEDRAL:
+    basis_ = Teuchos::rcp(new Intrepid2::Basis_HGRAD_HEX_C1_FEM<PHX::Device>());
+    lo_ = - lo_ * (1.0 + tolerance);
+    break;
+  }
+
+  coupled_nodeset_name_ = this_app.getNodesetName(coupled_app_index);
+
+  ns_coord_ =
+      this_stk_disc->getNodeSetCoords().find(coupled_nodeset_name_)->second;
+
+  // Snapshot of the coupled coordinates. getCoordinates() walks every
+  // overlap node, so it is done once per mesh and not once per point.
+  Teuchos::ArrayRCP<double> const &
+  coupled_coordinates = coupled_stk_disc->getCoordinates();
+
+  coordinates_.assign(coupled_coordinates.begin(), coupled_coordinates.end());
+
+  Teuchos::RCP<Tpetra_Map const>
+  coupled_overlap_node_map = coupled_stk_disc->getOverlapNodeMapT();
+
+  auto const &
+  ws_elem_to_node_id = coupled_stk_disc->getWsElNodeID();
+
+  // Gather the connectivity of the coupled elements in workset order.
+  element_nodes_.clear();
+
+  for (auto workset = 0; workset < ws_elem_to_node_id.size(); ++workset) {
+
+    std::string const &
+    coupled_element_block = coupled_ws_eb_names[workset];
+
+    bool const
+    block_names_differ = coupled_element_block != coupled_block_name;
+
+    if (use_block == true && block_names_differ == true) continue;
+
+    auto const
+    elements_per_workset = ws_elem_to_node_id[workset].size();
+
+    for (auto element = 0; element < elements_per_workset; ++element) {
+      for (auto node = 0; node < node_count_; ++node) {
+
+        auto const
+        global_node_id = ws_elem_to_node_id[workset][element][node];
+
+        element_nodes_.push_back(
+            coupled_overlap_node_map->getLocalElement(global_node_id));
+
+      } // node loop
+    } // element loop
+  } // workset loop
+
+  auto const
+  number_elements = static_cast<int>(element_nodes_.size()) / node_count_;
+
+  centroids_.resize(number_elements);
+  element_order_.resize(number_elements);
+
+  for (auto element = 0; element < number_elements; ++element) {
+
+    Box const
+    box = elementBox(element);
+
+    for (auto i = 0; i < 3; ++i) {
+      centroids_[element][i] = 0.5 * (box[i] + box[3 + i]);
+    }
+
+    element_order_[element] = element;
+  }
+
+  bvh_.clear();
+  bvh_.reserve(2 * (number_elements / leaf_size + 1));
+
+  if (number_elements > 0) buildHierarchy(0, number_elements);
+
+  // Work containers. Rank 3 for mapToReferenceFrame, rank 2 for getValues.
+  parametric_point_ = Kokkos::DynRankView<RealType, PHX::Device>(
+      "par_point", 1, 1, parametric_dimension);
+
+  physical_point_ = Kokkos::DynRankView<RealType, PHX::Device>(
+      "phys_point", 1, 1, dimension_);
+
+  nodal_coordinates_ = Kokkos::DynRankView<RealType, PHX::Device>(
+      "coords", 1, node_count_, dimension_);
+
+  pp_reduced_ = Kokkos::DynRankView<RealType, PHX::Device>(
+      "par_point", 1, parametric_dimension);
+
+  basis_values_ = Kokkos::DynRankView<RealType, PHX::Device>(
+      "basis", node_count_, 1);
+
+  // Forget all located points.
+  ns_element_.assign(ns_coord_.size(), -1);
+  ns_basis_values_.assign(ns_coord_.size() * node_count_, 0.0);
+}
+
+//
+// Axis-aligned box of an element, enlarged by the tolerance.
+//
+SchwarzPointCache::Box
+SchwarzPointCache::
+elementBox(int const element) const
+{
+  double const
+  max = std::numeric_limits<double>::max();
+
+  Box
+  box{{max, max, max, -max, -max, -max}};
+
+  for (auto i = dimension_; i < 3; ++i) {
+    box[i] = 0.0;
+    box[3 + i] = 0.0;
+  }
+
+  for (auto node = 0; node < node_count_; ++node) {
+
+    auto const
+    local_node_id = element_nodes_[element * node_count_ + node];
+
+    double const * const
+    pcoord = &(coordinates_[dimension_ * local_node_id]);
+
+    for (auto i = 0; i < dimension_; ++i) {
+      box[i] = std::min(box[i], pcoord[i]);
+      box[3 + i] = std::max(box[3 + i], pcoord[i]);
+    }
+  }
+
+  double
+  extent = 0.0;
+
+  for (auto i = 0; i < dimension_; ++i) {
+    extent = std::max(extent, box[3 + i] - box[i]);
+  }
+
+  for (auto i = 0; i < dimension_; ++i) {
+    box[i] -= tolerance * extent;
+    box[3 + i] += tolerance * extent;
+  }
+
+  return box;
+}
+
+//
+// Top-down median split along the longest axis of the centroids.
+//
+int
+SchwarzPointCache::
+buildHierarchy(int const begin, int const end)
+{
+  auto const
+  index = static_cast<int>(bvh_.size());
+
+  bvh_.emplace_back();
+
+  double const
+  max = std::numeric_limits<double>::max();
+
+  Box
+  box{{max, max, max, -max, -max, -max}};
+
+  Box
+  centroid_box = box;
+
+  for (auto i = begin; i < end; ++i) {
+
+    auto const
+    element = element_order_[i];
+
+    Box const
+    element_box = elementBox(element);
+
+    for (auto j = 0; j < 3; ++j) {
+      box[j] = std::min(box[j], element_box[j]);
+      box[3 + j] = std::max(box[3 + j], element_box[3 + j]);
+      centroid_box[j] = std::min(centroid_box[j], centroids_[element][j]);
+      centroid_box[3 + j] = std::max(centroid_box[3 + j], centroids_[element][j]);
+    }
+  }
+
+  bvh_[index].box = box;
+  bvh_[index].begin = begin;
+  bvh_[index].end = end;
+
+  if (end - begin <= leaf_size) return index;
+
+  auto
+  axis = 0;
+
+  for (auto j = 1; j < 3; ++j) {
+    auto const
+    width = centroid_box[3 + j] - centroid_box[j];
+    if (width > centroid_box[3 + axis] - centroid_box[axis]) axis = j;
+  }
+
+  auto const
+  middle = begin + (end - begin) / 2;
+
+  std::nth_element(
+      element_order_.begin() + begin,
+      element_order_.begin() + middle,
+      element_order_.begin() + end,
+      [this, axis](int const a, int const b) {
+        return centroids_[a][axis] < centroids_[b][axis];
+      });
+
+  auto const
+  left = buildHierarchy(begin, middle);
+
+  auto const
+  right = buildHierarchy(middle, end);
+
+  bvh_[index].left = left;
+  bvh_[index].right = right;
+
+  return index;
+}
+
+//
+// Parametric coordinates of a point in an element. True if inside.
+//
+bool
+SchwarzPointCache::
+mapToElement(int const element, double const * const point)
+{
+  for (auto i = 0; i < dimension_; ++i) {
+    physical_point_(0, 0, i) = point[i];
+  }
+
+  for (auto node = 0; node < node_count_; ++node) {
+
+    auto const
+    local_node_id = element_nodes_[element * node_count_ + node];
+
+    for (auto i = 0; i < dimension_; ++i) {
+      nodal_coordinates_(0, node, i) =
+          coordinates_[dimension_ * local_node_id + i];
+    }
+  }
+
+  Intrepid2::CellTools<PHX::Device>::mapToReferenceFrame(
+      parametric_point_,
+      physical_point_,
+      nodal_coordinates_,
+      *cell_topology_);
+
+  bool
+  in_element = true;
+
+  for (auto i = 0; i < dimension_; ++i) {
+    auto const
+    xi = parametric_point_(0, 0, i);
+    in_element = in_element && lo_(i) <= xi && xi <= hi_(i);
+  }
+
+  return in_element;
+}
+
+//
+//
+//
+void
+SchwarzPointCache::
+locate(size_t const ns_node)
+{
+  double const * const
+  point = ns_coord_[ns_node];
+
+  // Collect the elements whose boxes contain the point.
+  candidates_.clear();
+  stack_.clear();
+
+  if (bvh_.empty() == false) stack_.push_back(0);
+
+  while (stack_.empty() == false) {
+
+    BVHNode const &
+    bvh_node = bvh_[stack_.back()];
+
+    stack_.pop_back();
+
+    if (inBox(bvh_node.box, point, dimension_) == false) continue;
+
+    if (bvh_node.left < 0) {
+      for (auto i = bvh_node.begin; i < bvh_node.end; ++i) {
+        auto const
+        element = element_order_[i];
+
+        if (inBox(elementBox(element), point, dimension_) == true) {
+          candidates_.push_back(element);
+        }
+      }
+      continue;
+    }
+
+    stack_.push_back(bvh_node.right);
+    stack_.push_back(bvh_node.left);
+  }
+
+  // Try candidates in workset order, as a linear search would.
+  std::sort(candidates_.begin(), candidates_.end());
+
+  auto
+  found_element = -1;
+
+  for (auto const element : candidates_) {
+    if (mapToElement(element, point) == true) {
+      found_element = element;
+      break;
+    }
+  }
+
+  // As with the linear search, a point outside the tolerance is an error
+  // only in debug builds. Release builds use the last coupled element, the
+  // one the linear search ended on.
+  ALBANY_EXPECT(
+      found_element >= 0,
+      "Node set " << coupled_nodeset_name_ << " node " << ns_node <<
+      " is not inside any coupled element");
+
+  if (found_element < 0) {
+    auto const
+    number_elements = static_cast<int>(element_nodes_.size()) / node_count_;
+
+    ALBANY_ASSERT(
+        number_elements > 0,
+        "Node set " << coupled_nodeset_name_ << " has no coupled elements");
+
+    found_element = number_elements - 1;
+    mapToElement(found_element, point);
+  }
+
+  // Evaluate shape functions at parametric point.
+  for (auto j = 0; j < dimension_; ++j) {
+    pp_reduced_(0, j) = parametric_point_(0, 0, j);
+  }
+
+  basis_->getValues(basis_values_, pp_reduced_, Intrepid2::OPERATOR_VALUE);
+
+  for (auto node = 0; node < node_count_; ++node) {
+    ns_basis_values_[ns_node * node_count_ + node] = basis_values_(node, 0);
+  }
+
+  ns_element_[ns_node] = found_element;
+}
+
+//
+//
+//
+minitensor::Vector<double>
+SchwarzPointCache::
+interpolate(size_t const ns_node, Teuchos::ArrayRCP<ST const> const & solution)
+{
+  if (ns_element_[ns_node] < 0) locate(ns_node);
+
+  auto const
+  element = ns_element_[ns_node];
+
+  // Evaluate solution at parametric point using the cached values of the
+  // shape functions.
+  minitensor::Vector<double>
+  value(dimension_, minitensor::Filler::ZEROS);
+
+  for (auto node = 0; node < node_count_; ++node) {
+
+    auto const
+    local_node_id = element_nodes_[element * node_count_ + node];
+
+    auto const
+    basis_value = ns_basis_values_[ns_node * node_count_ + node];
+
+    for (auto i = 0; i < dimension_; ++i) {
+      value(i) += basis_value * solution[dimension_ * local_node_id + i];
+    }
+  }
+
+  return value;
+}
+
+} // namespace LCM
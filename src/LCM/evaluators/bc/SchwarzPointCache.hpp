@@ -0,0 +1,177 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#if !defined(LCM_SchwarzPointCache_hpp)
+#define LCM_SchwarzPointCache_hpp
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include "Albany_DataTypes.hpp"
+#include "Intrepid2_Basis.hpp"
+#include "Kokkos_DynRankView.hpp"
+#include "MiniTensor.h"
+#include "Phalanx_KokkosDeviceTypes.hpp"
+#include "Shards_CellTopology.hpp"
+
+namespace Albany {
+class Application;
+class STKDiscretization;
+}
+
+namespace LCM {
+
+//
+// \brief Location of the node set nodes of one Schwarz BC inside the
+// elements of the coupled application.
+//
+// A bounding volume hierarchy over the elements of the coupled
+// discretization is built once per mesh, and for each node set node the
+// containing element and the shape function values at its parametric
+// coordinates are kept until either mesh changes.
+//
+class SchwarzPointCache {
+public:
+
+  SchwarzPointCache() = default;
+
+  //
+  // Rebuild the element hierarchy and forget the located nodes if either
+  // discretization has changed since the last call.
+  //
+  void
+  update(
+      Albany::Application const & this_app,
+      Albany::Application const & coupled_app,
+      int const coupled_app_index);
+
+  //
+  // Interpolate the coupled solution at a node set node.
+  //
+  minitensor::Vector<double>
+  interpolate(size_t const ns_node, Teuchos::ArrayRCP<ST const> const & solution);
+
+private:
+
+  using Box = std::array<double, 6>;
+
+  struct BVHNode {
+    Box box;
+    int left{-1};
+    int right{-1};
+    int begin{0};
+    int end{0};
+  };
+
+  void
+  build(
+      Albany::Application const & this_app,
+      Albany::Application const & coupled_app,
+      int const coupled_app_index);
+
+  int
+  buildHierarchy(int const begin, int const end);
+
+  void
+  locate(size_t const ns_node);
+
+  bool
+  mapToElement(int const element, double const * const point);
+
+  Box
+  elementBox(int const element) const;
+
+  Albany::STKDiscretization const *
+  this_disc_{nullptr};
+
+  Albany::STKDiscretization const *
+  coupled_disc_{nullptr};
+
+  int
+  this_version_{-1};
+
+  int
+  coupled_version_{-1};
+
+  std::string
+  coupled_nodeset_name_;
+
+  int
+  dimension_{0};
+
+  int
+  node_count_{0};
+
+  Teuchos::RCP<shards::CellTopology>
+  cell_topology_;
+
+  Teuchos::RCP<Intrepid2::Basis<PHX::Device, RealType, RealType>>
+  basis_;
+
+  // Parametric bounds, with tolerance, for a point inside an element
+  minitensor::Vector<double>
+  lo_;
+
+  minitensor::Vector<double>
+  hi_;
+
+  // Node set node coordinates of this application
+  std::vector<double *>
+  ns_coord_;
+
+  // Coupled overlap coordinates at the time of the last build
+  std::vector<double>
+  coordinates_;
+
+  // Overlap local node ids of the coupled elements, node_count_ per element
+  std::vector<LO>
+  element_nodes_;
+
+  // Element indices ordered by the leaves of the hierarchy
+  std::vector<int>
+  element_order_;
+
+  std::vector<std::array<double, 3>>
+  centroids_;
+
+  std::vector<BVHNode>
+  bvh_;
+
+  // Per node set node: containing element (-1 if not yet located) and
+  // shape function values at its parametric coordinates
+  std::vector<int>
+  ns_element_;
+
+  std::vector<double>
+  ns_basis_values_;
+
+  // Work containers reused by every mapping
+  Kokkos::DynRankView<RealType, PHX::Device>
+  parametric_point_;
+
+  Kokkos::DynRankView<RealType, PHX::Device>
+  physical_point_;
+
+  Kokkos::DynRankView<RealType, PHX::Device>
+  nodal_coordinates_;
+
+  Kokkos::DynRankView<RealType, PHX::Device>
+  pp_reduced_;
+
+  Kokkos::DynRankView<RealType, PHX::Device>
+  basis_values_;
+
+  std::vector<int>
+  candidates_;
+
+  std::vector<int>
+  stack_;
+};
+
+} // namespace LCM
+
+#endif // LCM_SchwarzPointCache_hpp
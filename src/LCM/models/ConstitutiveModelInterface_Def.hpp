@@ -40,6 +40,8 @@
 #include "TvergaardHutchinsonModel.hpp"
 #include "ViscoElasticModel.hpp"
 
+#include "../parallel_models/ParallelElasticDamageModel.hpp"
+#include "../parallel_models/ParallelJ2Model.hpp"
 #include "../parallel_models/ParallelNeohookeanModel.hpp"
 
 namespace LCM {
@@ -278,6 +280,8 @@ ConstitutiveModelInterface<EvalT, Traits>::initializeModel(
     model = rcp(new CreepModel<EvalT, Traits>(p, dl));
   } else if (model_name == "J2") {
     model = rcp(new J2Model<EvalT, Traits>(p, dl));
+  } else if (model_name == "Parallel J2") {
+    model = rcp(new ParallelJ2Model<EvalT, Traits>(p, dl));
   } else if (model_name == "Newtonian Fluid") {
     model = rcp(new NewtonianFluidModel<EvalT, Traits>(p, dl));
   } else if (model_name == "CrystalPlasticity") {
@@ -302,6 +306,8 @@ ConstitutiveModelInterface<EvalT, Traits>::initializeModel(
     model = rcp(new AnisotropicDamageModel<EvalT, Traits>(p, dl));
   } else if (model_name == "Elastic Damage") {
     model = rcp(new ElasticDamageModel<EvalT, Traits>(p, dl));
+  } else if (model_name == "Parallel Elastic Damage") {
+    model = rcp(new ParallelElasticDamageModel<EvalT, Traits>(p, dl));
   } else if (model_name == "Saint Venant Kirchhoff") {
     model = rcp(new StVenantKirchhoffModel<EvalT, Traits>(p, dl));
   } else if (model_name == "AAA") {
@@ -14,6 +14,9 @@
 #include "NOX_StatusTest_ModelEvaluatorFlag.h"
 #include "../../utility/StaticAllocator.hpp"
 
+#include <memory>
+#include <mutex>
+
 namespace LCM
 {
 
@@ -108,6 +111,26 @@ public:
 
 private:
 
+  ///
+  /// Slip systems and elasticity tensor rotated into a lattice orientation
+  ///
+  struct RotatedLattice
+  {
+    minitensor::Tensor<RealType, CP::MAX_DIM>
+    orientation;
+
+    minitensor::Tensor4<ScalarT, CP::MAX_DIM>
+    C;
+
+    std::vector<CP::SlipSystem<CP::MAX_DIM>>
+    slip_systems;
+  };
+
+  void
+  rotateLattice(
+      minitensor::Tensor<RealType, CP::MAX_DIM> const & orientation,
+      RotatedLattice & lattice) const;
+
   ///
   /// Crystal elasticity parameters
   ///
@@ -345,6 +368,49 @@ private:
   Teuchos::ArrayRCP<RealType*>
   rotation_matrix_transpose_;
 
+  ///
+  /// Rotated lattices, computed once and reused at every evaluation. With
+  /// orientations from the mesh there is one entry per cell, stored by
+  /// workset; otherwise a single entry for the element block.
+  ///
+  std::vector<std::vector<RotatedLattice>>
+  rotated_lattices_;
+
+  ///
+  /// Mesh version the lattices of each workset were rotated for
+  ///
+  std::vector<int>
+  rotated_lattices_version_;
+
+  std::vector<RotatedLattice> const *
+  workset_lattices_{nullptr};
+
+  ///
+  /// Scratch arenas for the integrators. A point takes one from the pool
+  /// and gives it back when it is done, so the pool holds at most one arena
+  /// per thread evaluating points, whatever the workset size.
+  ///
+  struct AllocatorRelease
+  {
+    CrystalPlasticityKernel const *
+    kernel;
+
+    void
+    operator()(utility::StaticAllocator * allocator) const;
+  };
+
+  using PooledAllocator =
+  std::unique_ptr<utility::StaticAllocator, AllocatorRelease>;
+
+  PooledAllocator
+  acquireAllocator() const;
+
+  mutable std::mutex
+  allocators_mutex_;
+
+  mutable std::vector<std::unique_ptr<utility::StaticAllocator>>
+  allocators_;
+
 };
 
 template<typename EvalT, typename Traits>
@@ -416,6 +416,29 @@ CrystalPlasticityKernel(
 //
 // Initialize state for computing the constitutive response of the material
 //
+template<typename EvalT, typename Traits>
+void
+CrystalPlasticityKernel<EvalT, Traits>::rotateLattice(
+    minitensor::Tensor<RealType, CP::MAX_DIM> const & orientation,
+    RotatedLattice & lattice) const
+{
+  // Set the rotated elasticity tensor, slip normals, slip directions,
+  // and projection operator
+  lattice.orientation = orientation;
+  lattice.C = minitensor::kronecker(orientation, C_unrotated_);
+  lattice.slip_systems = slip_systems_;
+
+  for (int num_ss = 0; num_ss < num_slip_; ++num_ss)
+  {
+    auto &
+    slip_system = lattice.slip_systems.at(num_ss);
+
+    slip_system.s_ = orientation * slip_systems_.at(num_ss).s_;
+    slip_system.n_ = orientation * slip_systems_.at(num_ss).n_;
+    slip_system.projector_ = minitensor::dyad(slip_system.s_, slip_system.n_);
+  }
+}
+
 template<typename EvalT, typename Traits>
 void CrystalPlasticityKernel<EvalT, Traits>::init(
     Workset & workset,
@@ -438,6 +461,52 @@ void CrystalPlasticityKernel<EvalT, Traits>::init(
     rotation_matrix_transpose_ = workset.wsLatticeOrientation;
     ALBANY_ASSERT(rotation_matrix_transpose_.is_null() == false,
         "Rotation matrix not found on genesis mesh");
+
+    // Rotate the lattice of each cell the first time a workset is seen, or
+    // again if the mesh changed (e.g. after remeshing). A negative mesh
+    // version, or no discretization (e.g. the material point simulator),
+    // means changes are not tracked.
+    auto const
+    ws = workset.wsIndex;
+
+    int const
+    mesh_version = workset.disc.is_null() ? -1 : workset.disc->getMeshVersion();
+
+    if (rotated_lattices_.size() <= ws) {
+      rotated_lattices_.resize(ws + 1);
+      rotated_lattices_version_.resize(ws + 1, -1);
+    }
+
+    if (mesh_version < 0 || rotated_lattices_version_[ws] != mesh_version ||
+        rotated_lattices_[ws].size() != workset.numCells) {
+      auto &
+      lattices = rotated_lattices_[ws];
+
+      lattices.resize(workset.numCells);
+
+      minitensor::Tensor<RealType, CP::MAX_DIM>
+      orientation_matrix(num_dims_);
+
+      for (int cell = 0; cell < workset.numCells; ++cell) {
+        for (int i = 0; i < 3; ++i) {
+          for (int j = 0; j < 3; ++j) {
+            orientation_matrix(i,j) = rotation_matrix_transpose_[cell][i * 3 + j];
+          }
+        }
+        rotateLattice(orientation_matrix, lattices[cell]);
+      }
+      rotated_lattices_version_[ws] = mesh_version;
+    }
+    workset_lattices_ = &rotated_lattices_[ws];
+  }
+  else
+  {
+    if (rotated_lattices_.empty()) {
+      rotated_lattices_.resize(1);
+      rotated_lattices_[0].resize(1);
+      rotateLattice(element_block_orientation_, rotated_lattices_[0][0]);
+    }
+    workset_lattices_ = &rotated_lattices_[0];
   }
 
   //
@@ -493,6 +562,43 @@ void CrystalPlasticityKernel<EvalT, Traits>::init(
 }
 
 
+template<typename EvalT, typename Traits>
+typename CrystalPlasticityKernel<EvalT, Traits>::PooledAllocator
+CrystalPlasticityKernel<EvalT, Traits>::acquireAllocator() const
+{
+  std::unique_ptr<utility::StaticAllocator>
+  allocator;
+
+  {
+    std::lock_guard<std::mutex>
+    lock(allocators_mutex_);
+
+    if (allocators_.empty() == false) {
+      allocator = std::move(allocators_.back());
+      allocators_.pop_back();
+    }
+  }
+
+  if (allocator == nullptr) {
+    allocator.reset(new utility::StaticAllocator(1024 * 1024));
+  }
+
+  allocator->clear();
+  return PooledAllocator(allocator.release(), AllocatorRelease{this});
+}
+
+template<typename EvalT, typename Traits>
+void
+CrystalPlasticityKernel<EvalT, Traits>::AllocatorRelease::operator()(
+    utility::StaticAllocator * allocator) const
+{
+  std::lock_guard<std::mutex>
+  lock(kernel->allocators_mutex_);
+
+  kernel->allocators_.emplace_back(allocator);
+}
+
+
 template<typename EvalT, typename Traits>
 KOKKOS_INLINE_FUNCTION void
 CrystalPlasticityKernel<EvalT, Traits>::operator()(int cell, int pt) const
@@ -504,11 +610,13 @@ CrystalPlasticityKernel<EvalT, Traits>::operator()(int cell, int pt) const
     }
     return;
   }
-  // TODO: In the future for CUDA this should be moved out of the kernel because
-  // it uses dynamic allocation for the buffer. It should also be modified to use 
-  // cudaMalloc.
-  utility::StaticAllocator 
-  allocator(1024 * 1024);
+  // TODO: In the future for CUDA the arenas should be allocated with cudaMalloc.
+  // Declared before anything allocated in it, so it is returned last.
+  PooledAllocator
+  pooled_allocator = acquireAllocator();
+
+  utility::StaticAllocator &
+  allocator = *pooled_allocator;
 
   //
   // Known quantities
@@ -555,26 +663,27 @@ CrystalPlasticityKernel<EvalT, Traits>::operator()(int cell, int pt) const
   minitensor::Vector<ScalarT, CP::MAX_SLIP>
   state_hardening_np1(num_slip_);
 
-  ///
-  /// Elasticity tensor
-  ///
-  minitensor::Tensor4<ScalarT, CP::MAX_DIM>
-  C_unrotated = C_unrotated_;
-
-  minitensor::Tensor4<ScalarT, CP::MAX_DIM>
-  C(num_dims_);
-
   RealType
   norm_slip_residual;
 
-  minitensor::Tensor<RealType, CP::MAX_DIM>
-  orientation_matrix(num_dims_);
+  ///
+  /// Rotated slip systems and elasticity tensor
+  ///
+  RotatedLattice const &
+  lattice = read_orientations_from_mesh_ ?
+    (*workset_lattices_)[cell] : (*workset_lattices_)[0];
+
+  std::vector<CP::SlipSystem<CP::MAX_DIM>> const &
+  element_slip_systems = lattice.slip_systems;
 
-  std::vector<CP::SlipSystem<CP::MAX_DIM>>
-  element_slip_systems = slip_systems_;
+  minitensor::Tensor4<ScalarT, CP::MAX_DIM>
+  C = lattice.C;
 
   if (have_temperature_)
   {
+    minitensor::Tensor4<ScalarT, CP::MAX_DIM>
+    C_unrotated(num_dims_);
+
     RealType const
     tlocal = SSV::eval(temperature_(cell,pt));
 
@@ -601,36 +710,15 @@ CrystalPlasticityKernel<EvalT, Traits>::operator()(int cell, int pt) const
 
     CP::computeElasticityTensor(c11, c12, c13, c33, c44, c66, C_unrotated);
 
+    // The temperature dependent tensor must be rotated at every point
+    C = minitensor::kronecker(lattice.orientation, C_unrotated);
+
     if (verbosity_ >= CP::Verbosity::HIGH) {
       std::cout << "tlocal: " << tlocal << std::endl;
       std::cout << "c11, c12, c44: " << c11 << c12 << c44 << std::endl;
     }
   }
 
-  if (read_orientations_from_mesh_) {
-    for (int i = 0; i < 3; ++i) {
-      for (int j = 0; j < 3; ++j) {
-        orientation_matrix(i,j) = rotation_matrix_transpose_[cell][i * 3 + j];
-      }
-    }
-  }
-  else {
-    orientation_matrix = element_block_orientation_;
-  }
-
-  // Set the rotated elasticity tensor, slip normals, slip directions, 
-  // and projection operator
-  C = minitensor::kronecker(orientation_matrix, C_unrotated);
-  for (int num_ss = 0; num_ss < num_slip_; ++num_ss)
-  {
-    auto &
-    slip_system = element_slip_systems.at(num_ss);
-
-    slip_system.s_ = orientation_matrix * slip_systems_.at(num_ss).s_;
-    slip_system.n_ = orientation_matrix * slip_systems_.at(num_ss).n_;
-    slip_system.projector_ = minitensor::dyad(slip_system.s_, slip_system.n_);
-  }
-
   // Copy data from Albany fields into local data structures
   for (int i(0); i < num_dims_; ++i) {
     for (int j(0); j < num_dims_; ++j) {
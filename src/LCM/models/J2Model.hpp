@@ -75,6 +75,11 @@ class J2Model : public LCM::ConstitutiveModel<EvalT, Traits> {
   ///
   RealType sat_mod_, sat_exp_;
 
+  ///
+  /// Slot of the model in the workset scratch peak usage
+  ///
+  int scratch_user_;
+
   // Kokkos
   virtual void
   computeStateParallel(
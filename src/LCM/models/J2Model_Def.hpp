@@ -19,7 +19,9 @@ J2Model<EvalT, Traits>::J2Model(
     const Teuchos::RCP<Albany::Layouts>& dl)
     : LCM::ConstitutiveModel<EvalT, Traits>(p, dl),
       sat_mod_(p->get<RealType>("Saturation Modulus", 0.0)),
-      sat_exp_(p->get<RealType>("Saturation Exponent", 0.0))
+      sat_exp_(p->get<RealType>("Saturation Exponent", 0.0)),
+      scratch_user_(PHAL::WorksetScratch::registerUser(
+          "J2Model" + PHX::typeAsString<EvalT>()))
 {
   // retrive appropriate field name strings
   std::string cauchy_string       = (*field_name_map_)["Cauchy_Stress"];
@@ -156,6 +158,12 @@ J2Model<EvalT, Traits>::computeState(
   minitensor::Tensor<ScalarT> Fpn(num_dims_), Fpinv(num_dims_),
       Cpinv(num_dims_);
 
+  // Residual, Jacobian and unknown of the return mapping, taken from the
+  // workset scratch arena once and reused by every yielding point
+  PHAL::ScratchScope scratch(workset.scratch, scratch_user_);
+  std::vector<ScalarT>* const return_map = scratch.allocate<std::vector<ScalarT>>(3);
+  for (int i(0); i < 3; ++i) return_map[i].resize(1);
+
   for (int cell(0); cell < workset.numCells; ++cell) {
     for (int pt(0); pt < num_pts_; ++pt) {
       kappa = elastic_modulus(cell, pt) /
@@ -204,9 +212,9 @@ J2Model<EvalT, Traits>::computeState(
 
         LocalNonlinearSolver<EvalT, Traits> solver;
 
-        std::vector<ScalarT> F(1);
-        std::vector<ScalarT> dFdX(1);
-        std::vector<ScalarT> X(1);
+        std::vector<ScalarT>& F    = return_map[0];
+        std::vector<ScalarT>& dFdX = return_map[1];
+        std::vector<ScalarT>& X    = return_map[2];
 
         F[0] = f;
         X[0] = 0.0;
@@ -0,0 +1,20 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "PHAL_AlbanyTraits.hpp"
+
+#include "ParallelElasticDamageModel.hpp"
+#include "ParallelElasticDamageModel_Def.hpp"
+#include "../parallel_models/ParallelConstitutiveModel_Def.hpp"
+
+template<typename EvalT, typename Traits>
+LCM::ParallelElasticDamageModel<EvalT,Traits>::ParallelElasticDamageModel(Teuchos::ParameterList* p,
+    const Teuchos::RCP<Albany::Layouts>& dl):
+  LCM::ParallelConstitutiveModel<EvalT, Traits, ElasticDamageKernel<EvalT, Traits>>(p, dl)
+{}
+
+PHAL_INSTANTIATE_TEMPLATE_CLASS(LCM::ElasticDamageKernel)
+PHAL_INSTANTIATE_TEMPLATE_CLASS(LCM::ParallelElasticDamageModel)
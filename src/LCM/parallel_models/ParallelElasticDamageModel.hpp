@@ -0,0 +1,82 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#if !defined(LCM_ParallelElasticDamageModel_hpp)
+#define LCM_ParallelElasticDamageModel_hpp
+
+#include "Phalanx_config.hpp"
+#include "Phalanx_Evaluator_WithBaseImpl.hpp"
+#include "Phalanx_Evaluator_Derived.hpp"
+#include "Phalanx_MDField.hpp"
+#include "Albany_Layouts.hpp"
+#include "ParallelConstitutiveModel.hpp"
+
+namespace LCM
+{
+//! \brief Elastic Damage kernel, same update as ElasticDamageModel
+template<typename EvalT, typename Traits>
+struct ElasticDamageKernel : public ParallelKernel<EvalT, Traits>
+{
+  ///
+  /// Constructor
+  ///
+  ElasticDamageKernel(ConstitutiveModel<EvalT, Traits> &model,
+      Teuchos::ParameterList* p,
+      const Teuchos::RCP<Albany::Layouts>& dl);
+
+  ElasticDamageKernel(const ElasticDamageKernel&) = delete;
+  ElasticDamageKernel& operator=(const ElasticDamageKernel&) = delete;
+
+  using ScalarT = typename EvalT::ScalarT;
+  using ScalarField = PHX::MDField<ScalarT>;
+  using ConstScalarField = PHX::MDField<const ScalarT>;
+  using BaseKernel = ParallelKernel<EvalT, Traits>;
+  using Workset = typename BaseKernel::Workset;
+
+  using BaseKernel::num_dims_;
+  using BaseKernel::num_pts_;
+  using BaseKernel::field_name_map_;
+  using BaseKernel::compute_tangent_;
+
+  using BaseKernel::setDependentField;
+  using BaseKernel::setEvaluatedField;
+  using BaseKernel::addStateVariable;
+
+  // Dependent MDFields
+  ConstScalarField strain;
+  ConstScalarField poissons_ratio;
+  ConstScalarField elastic_modulus;
+
+  // Evaluated MDFields
+  ScalarField stress;
+  ScalarField energy;
+  ScalarField damage;
+  ScalarField tangent;
+
+  Albany::MDArray energy_old;
+
+  // Damage parameters
+  RealType max_damage;
+  RealType saturation;
+
+  void init(Workset &workset,
+       FieldMap<const ScalarT> &dep_fields,
+       FieldMap<ScalarT> &eval_fields);
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (int cell, int pt) const;
+};
+
+template<typename EvalT, typename Traits>
+class ParallelElasticDamageModel : public LCM::ParallelConstitutiveModel<EvalT, Traits, ElasticDamageKernel<EvalT, Traits>> {
+public:
+  ParallelElasticDamageModel(Teuchos::ParameterList* p,
+      const Teuchos::RCP<Albany::Layouts>& dl);
+};
+
+}
+
+#endif
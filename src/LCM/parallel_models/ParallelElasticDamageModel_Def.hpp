@@ -0,0 +1,160 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#if !defined(LCM_ParallelElasticDamageModel_Def_hpp)
+#define LCM_ParallelElasticDamageModel_Def_hpp
+
+#include <MiniTensor.h>
+#include "Teuchos_TestForException.hpp"
+#include "Phalanx_DataLayout.hpp"
+
+namespace LCM
+{
+
+//----------------------------------------------------------------------------
+template<typename EvalT, typename Traits>
+ElasticDamageKernel<EvalT, Traits>::
+ElasticDamageKernel(ConstitutiveModel<EvalT, Traits> &model,
+                    Teuchos::ParameterList* p,
+                    const Teuchos::RCP<Albany::Layouts>& dl)
+  : BaseKernel(model),
+    max_damage(p->get<RealType>("Maximum damage", 1.0)),
+    saturation(p->get<RealType>("Damage saturation", 0.0))
+{
+  // retrieve appropriate field name strings
+  std::string const cauchy_string = field_name_map_["Cauchy_Stress"];
+  std::string const energy_string = field_name_map_["Matrix_Energy"];
+  std::string const damage_string = field_name_map_["Matrix_Damage"];
+  std::string const tangent_string = field_name_map_["Material Tangent"];
+
+  // define the dependent fields
+  setDependentField("Strain", dl->qp_tensor);
+  setDependentField("Poissons Ratio", dl->qp_scalar);
+  setDependentField("Elastic Modulus", dl->qp_scalar);
+
+  // define the evaluated fields
+  setEvaluatedField(cauchy_string, dl->qp_tensor);
+  setEvaluatedField(energy_string, dl->qp_scalar);
+  setEvaluatedField(damage_string, dl->qp_scalar);
+  if (compute_tangent_) {
+    setEvaluatedField(tangent_string, dl->qp_tensor4);
+  }
+
+  // define the state variables
+  addStateVariable(cauchy_string, dl->qp_tensor, "scalar", 0.0, false, true);
+  addStateVariable(energy_string, dl->qp_scalar, "scalar", 0.0, true, true);
+  addStateVariable(damage_string, dl->qp_scalar, "scalar", 0.0, true, true);
+}
+
+template<typename EvalT, typename Traits>
+void
+ElasticDamageKernel<EvalT, Traits>::
+init(Workset &workset,
+     FieldMap<const ScalarT> &dep_fields,
+     FieldMap<ScalarT> &eval_fields)
+{
+  std::string const cauchy_string = field_name_map_["Cauchy_Stress"];
+  std::string const energy_string = field_name_map_["Matrix_Energy"];
+  std::string const damage_string = field_name_map_["Matrix_Damage"];
+  std::string const tangent_string = field_name_map_["Material Tangent"];
+
+  // extract dependent MDFields
+  strain = *dep_fields["Strain"];
+  poissons_ratio = *dep_fields["Poissons Ratio"];
+  elastic_modulus = *dep_fields["Elastic Modulus"];
+
+  // extract evaluated MDFields
+  stress = *eval_fields[cauchy_string];
+  energy = *eval_fields[energy_string];
+  damage = *eval_fields[damage_string];
+  if (compute_tangent_) {
+    tangent = *eval_fields[tangent_string];
+  }
+
+  // previous state
+  energy_old = (*workset.stateArrayPtr)[energy_string + "_old"];
+}
+
+// The operations below are those of ElasticDamageModel::computeState, in
+// the same order, so that both models give bitwise identical results.
+template<typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION void
+ElasticDamageKernel<EvalT, Traits>::
+operator()(int cell, int pt) const
+{
+  ScalarT mu, lame;
+  ScalarT alpha, damage_deriv;
+
+  // Define some tensors for use
+  minitensor::Tensor<ScalarT> epsilon(num_dims_), sigma(num_dims_);
+
+  minitensor::Tensor4<ScalarT> Ce(num_dims_);
+  minitensor::Tensor4<ScalarT> id4(num_dims_);
+  minitensor::Tensor4<ScalarT> id3(minitensor::identity_3<ScalarT>(num_dims_));
+
+  id4 = 0.5 * (minitensor::identity_1<ScalarT>(num_dims_)
+      + minitensor::identity_2<ScalarT>(num_dims_));
+
+  // local parameters
+  mu = elastic_modulus(cell, pt)
+      / (2.0 * (1.0 + poissons_ratio(cell, pt)));
+  lame = elastic_modulus(cell, pt) * poissons_ratio(cell, pt)
+      / (1.0 + poissons_ratio(cell, pt))
+      / (1.0 - 2.0 * poissons_ratio(cell, pt));
+
+  // small strain tensor
+  epsilon.fill(strain, cell, pt, 0, 0);
+
+  // undamaged elasticity tensor
+  Ce = lame * id3 + 2.0 * mu * id4;
+
+  // undamaged energy
+  energy(cell, pt) =
+      0.5 * minitensor::dotdot(minitensor::dotdot(epsilon, Ce), epsilon);
+
+  // undamaged Cauchy stress
+  sigma = minitensor::dotdot(Ce, epsilon);
+
+  // maximum thermodynamic force
+  alpha = energy_old(cell, pt);
+  if (energy(cell, pt) > alpha) alpha = energy(cell, pt);
+
+  // damage term
+  damage(cell, pt) = max_damage * (1 - std::exp(-alpha / saturation));
+
+  // derivative of damage w.r.t alpha
+  damage_deriv = max_damage / saturation * std::exp(-alpha / saturation);
+
+  // tangent for matrix considering damage
+  if (compute_tangent_) {
+    Ce = (1.0 - damage(cell, pt)) * Ce
+      - damage_deriv * minitensor::tensor(sigma, sigma);
+  }
+
+  // total Cauchy stress
+  for (int i(0); i < num_dims_; ++i) {
+    for (int j(0); j < num_dims_; ++j) {
+      stress(cell, pt, i, j) = (1.0 - damage(cell, pt)) * sigma(i, j);
+    }
+  }
+
+  // total tangent
+  if (compute_tangent_) {
+    for (int i(0); i < num_dims_; ++i) {
+      for (int j(0); j < num_dims_; ++j) {
+        for (int k(0); k < num_dims_; ++k) {
+          for (int l(0); l < num_dims_; ++l) {
+            tangent(cell, pt, i, j, k, l) = Ce(i, j, k, l);
+          }
+        }
+      }
+    }
+  }
+}
+
+}
+
+#endif
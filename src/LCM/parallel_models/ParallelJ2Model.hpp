@@ -0,0 +1,95 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#if !defined(LCM_ParallelJ2Model_hpp)
+#define LCM_ParallelJ2Model_hpp
+
+#include "Phalanx_config.hpp"
+#include "Phalanx_Evaluator_WithBaseImpl.hpp"
+#include "Phalanx_Evaluator_Derived.hpp"
+#include "Phalanx_MDField.hpp"
+#include "Albany_Layouts.hpp"
+#include "ParallelConstitutiveModel.hpp"
+
+namespace LCM
+{
+//! \brief J2 Plasticity kernel, same return mapping as J2Model
+template<typename EvalT, typename Traits>
+struct J2Kernel : public ParallelKernel<EvalT, Traits>
+{
+  ///
+  /// Constructor
+  ///
+  J2Kernel(ConstitutiveModel<EvalT, Traits> &model,
+      Teuchos::ParameterList* p,
+      const Teuchos::RCP<Albany::Layouts>& dl);
+
+  J2Kernel(const J2Kernel&) = delete;
+  J2Kernel& operator=(const J2Kernel&) = delete;
+
+  using ScalarT = typename EvalT::ScalarT;
+  using ScalarField = PHX::MDField<ScalarT>;
+  using ConstScalarField = PHX::MDField<const ScalarT>;
+  using BaseKernel = ParallelKernel<EvalT, Traits>;
+  using Workset = typename BaseKernel::Workset;
+
+  using BaseKernel::num_dims_;
+  using BaseKernel::num_pts_;
+  using BaseKernel::field_name_map_;
+
+  // optional temperature support
+  using BaseKernel::have_temperature_;
+  using BaseKernel::expansion_coeff_;
+  using BaseKernel::ref_temperature_;
+  using BaseKernel::heat_capacity_;
+  using BaseKernel::density_;
+  using BaseKernel::temperature_;
+
+  using BaseKernel::setDependentField;
+  using BaseKernel::setEvaluatedField;
+  using BaseKernel::addStateVariable;
+
+  // Dependent MDFields
+  ConstScalarField def_grad;
+  ConstScalarField J;
+  ConstScalarField poissons_ratio;
+  ConstScalarField elastic_modulus;
+  ConstScalarField yieldStrength;
+  ConstScalarField hardeningModulus;
+  ConstScalarField delta_time;
+
+  // Evaluated MDFields
+  ScalarField stress;
+  ScalarField Fp;
+  ScalarField eqps;
+  ScalarField yieldSurf;
+  ScalarField source;
+
+  Albany::MDArray Fpold;
+  Albany::MDArray eqpsold;
+
+  // Saturation hardening constants
+  RealType sat_mod;
+  RealType sat_exp;
+
+  void init(Workset &workset,
+       FieldMap<const ScalarT> &dep_fields,
+       FieldMap<ScalarT> &eval_fields);
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (int cell, int pt) const;
+};
+
+template<typename EvalT, typename Traits>
+class ParallelJ2Model : public LCM::ParallelConstitutiveModel<EvalT, Traits, J2Kernel<EvalT, Traits>> {
+public:
+  ParallelJ2Model(Teuchos::ParameterList* p,
+      const Teuchos::RCP<Albany::Layouts>& dl);
+};
+
+}
+
+#endif
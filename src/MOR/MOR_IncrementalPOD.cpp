@@ -0,0 +1,162 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+#include "MOR_IncrementalPOD.hpp"
+
+#include "MOR_BasisOps.hpp"
+
+#include "Epetra_LAPACK.h"
+#include "Epetra_LocalMap.h"
+#include "Epetra_Comm.h"
+
+#include "Teuchos_TestForException.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace MOR {
+
+IncrementalPOD::IncrementalPOD(int maxRank, double energyFraction, double tolerance) :
+  maxRank_(maxRank),
+  energyFraction_(energyFraction),
+  tolerance_(tolerance),
+  vectorCount_(0),
+  totalEnergy_(0.0)
+{
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      energyFraction <= 0.0,
+      std::out_of_range,
+      "energyFraction = " << energyFraction << ", should have energyFraction > 0");
+}
+
+// Brand's update: with U S the current factorization and c the new vector,
+// [U S, c] = [U, q] K [V 0; 0 1]^T where p = U^T c, r = c - U p, q = r / |r|
+// and K = [S p; 0 |r|]. The SVD of the small matrix K rotates [U, q].
+void IncrementalPOD::addVector(const Epetra_Vector &value)
+{
+  ++vectorCount_;
+
+  double valueNorm;
+  value.Norm2(&valueNorm);
+  totalEnergy_ += valueNorm * valueNorm;
+
+  const int oldRank = this->rank();
+  const int newSize = oldRank + 1;
+
+  // Component along the current basis, orthogonalized twice for stability
+  Epetra_Vector residual(value);
+  Teuchos::Array<double> components(oldRank, 0.0);
+  if (oldRank > 0) {
+    const Epetra_LocalMap componentMap(oldRank, 0, value.Comm());
+    Epetra_Vector pass(componentMap, false);
+    for (int iPass = 0; iPass < 2; ++iPass) {
+      reduce(*basis_, residual, pass);
+      residual.Multiply('N', 'N', -1.0, *basis_, pass, 1.0);
+      for (int i = 0; i < oldRank; ++i) {
+        components[i] += pass[i];
+      }
+    }
+  }
+
+  double residualNorm;
+  residual.Norm2(&residualNorm);
+  if (residualNorm <= tolerance_ * valueNorm) {
+    // No new direction
+    residualNorm = 0.0;
+  }
+
+  // K = [S p; 0 |r|], column-major
+  Teuchos::Array<double> kernel(newSize * newSize, 0.0);
+  for (int i = 0; i < oldRank; ++i) {
+    kernel[i + i * newSize] = singularValues_[i];
+    kernel[i + oldRank * newSize] = components[i];
+  }
+  kernel[oldRank + oldRank * newSize] = residualNorm;
+
+  Teuchos::Array<double> sigma(newSize);
+  Teuchos::Array<double> leftVectors(newSize * newSize);
+  {
+    const Epetra_LAPACK lapack;
+    int lwork = 8 * newSize;
+    Teuchos::Array<double> work(lwork);
+    double dummyVT;
+    int info;
+    lapack.GESVD('A', 'N', newSize, newSize, kernel.getRawPtr(), newSize,
+        sigma.getRawPtr(), leftVectors.getRawPtr(), newSize, &dummyVT, 1,
+        work.getRawPtr(), &lwork, &info);
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        info != 0,
+        std::runtime_error,
+        "GESVD failed with info = " << info);
+  }
+
+  const int newRank = this->truncatedRank(sigma());
+  if (newRank == 0) {
+    return;
+  }
+
+  // [U, q]
+  Epetra_MultiVector extended(value.Map(), newSize, false);
+  for (int i = 0; i < oldRank; ++i) {
+    *extended(i) = *(*basis_)(i);
+  }
+  if (residualNorm > 0.0) {
+    extended(oldRank)->Scale(1.0 / residualNorm, residual);
+  } else {
+    extended(oldRank)->PutScalar(0.0);
+  }
+
+  // U <- [U, q] * leftVectors(:, 0:newRank)
+  const Epetra_LocalMap rotationMap(newSize, 0, value.Comm());
+  const Epetra_MultiVector rotation(View, rotationMap, leftVectors.getRawPtr(), newSize, newRank);
+  const Teuchos::RCP<Epetra_MultiVector> newBasis(new Epetra_MultiVector(value.Map(), newRank, false));
+  expand(extended, rotation, *newBasis);
+
+  basis_ = newBasis;
+  singularValues_.assign(sigma.begin(), sigma.begin() + newRank);
+}
+
+int IncrementalPOD::truncatedRank(Teuchos::ArrayView<const double> sigma) const
+{
+  int result = sigma.size();
+
+  // Numerically zero modes
+  const double threshold = tolerance_ * (sigma.size() > 0 ? sigma[0] : 0.0);
+  while (result > 0 && sigma[result - 1] <= threshold) {
+    --result;
+  }
+
+  if (maxRank_ > 0) {
+    result = std::min(result, maxRank_);
+  }
+
+  if (energyFraction_ < 1.0) {
+    double capturedEnergy = 0.0;
+    for (int i = 0; i < result; ++i) {
+      capturedEnergy += sigma[i] * sigma[i];
+      if (capturedEnergy >= energyFraction_ * totalEnergy_) {
+        result = i + 1;
+        break;
+      }
+    }
+  }
+
+  return result;
+}
+
+double IncrementalPOD::discardedEnergyFraction() const
+{
+  if (totalEnergy_ <= 0.0) {
+    return 0.0;
+  }
+
+  double capturedEnergy = 0.0;
+  for (Teuchos::Array<double>::const_iterator it = singularValues_.begin(); it != singularValues_.end(); ++it) {
+    capturedEnergy += (*it) * (*it);
+  }
+  return std::max(0.0, 1.0 - capturedEnergy / totalEnergy_);
+}
+
+} // namespace MOR
@@ -0,0 +1,59 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+#ifndef MOR_INCREMENTALPOD_HPP
+#define MOR_INCREMENTALPOD_HPP
+
+#include "Epetra_MultiVector.h"
+#include "Epetra_Vector.h"
+
+#include "Teuchos_Array.hpp"
+#include "Teuchos_RCP.hpp"
+
+namespace MOR {
+
+// Rank-revising truncated SVD of a stream of snapshots.
+// Only the left singular vectors and the singular values are kept, so memory
+// is bounded by the retained rank rather than by the number of snapshots.
+class IncrementalPOD {
+public:
+  // maxRank <= 0: no rank limit
+  // energyFraction >= 1.0: no energy-based truncation
+  // tolerance: singular values below tolerance * largest are discarded
+  IncrementalPOD(int maxRank, double energyFraction, double tolerance);
+
+  void addVector(const Epetra_Vector &value);
+
+  int rank() const { return singularValues_.size(); }
+  int vectorCount() const { return vectorCount_; }
+
+  // Left singular vectors, null until a non-zero vector has been added
+  Teuchos::RCP<const Epetra_MultiVector> basis() const { return basis_; }
+  Teuchos::ArrayView<const double> singularValues() const { return singularValues_(); }
+
+  // Fraction of the energy of all added vectors not captured by the basis
+  double discardedEnergyFraction() const;
+
+private:
+  int maxRank_;
+  double energyFraction_;
+  double tolerance_;
+
+  int vectorCount_;
+  double totalEnergy_;
+
+  Teuchos::RCP<Epetra_MultiVector> basis_;
+  Teuchos::Array<double> singularValues_;
+
+  int truncatedRank(Teuchos::ArrayView<const double> sigma) const;
+
+  // Disallow copy and assignment
+  IncrementalPOD(const IncrementalPOD &);
+  IncrementalPOD &operator=(const IncrementalPOD &);
+};
+
+} // namespace MOR
+
+#endif /*MOR_INCREMENTALPOD_HPP*/
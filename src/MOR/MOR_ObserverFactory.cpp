@@ -9,6 +9,7 @@
 #include "MOR_MultiVectorOutputFileFactory.hpp"
 #include "MOR_ReducedSpace.hpp"
 #include "MOR_ReducedSpaceFactory.hpp"
+#include "MOR_IncrementalPOD.hpp"
 
 #include "MOR_NOXEpetraCompositeObserver.hpp"
 #include "MOR_SnapshotCollectionObserver.hpp"
@@ -48,9 +49,20 @@ RCP<ParameterList> fillDefaultProjectionErrorOutputParams(const RCP<ParameterLis
   return fillDefaultOutputParams(params, "proj_error");
 }
 
+RCP<ParameterList> getStreamingPODParams(const RCP<ParameterList> &params)
+{
+  return sublist(params, "Streaming POD");
+}
+
+bool useStreamingPOD(const RCP<ParameterList> &params)
+{
+  return getStreamingPODParams(params)->get("Activate", false);
+}
+
 RCP<ParameterList> fillDefaultSnapshotOutputParams(const RCP<ParameterList> &params)
 {
-  return fillDefaultOutputParams(params, "snapshots");
+  // In streaming mode the file receives the basis, not the snapshots
+  return fillDefaultOutputParams(params, useStreamingPOD(params) ? "basis" : "snapshots");
 }
 
 RCP<MultiVectorOutputFile> createOutputFile(const RCP<ParameterList> &params)
@@ -74,6 +86,18 @@ int getSnapshotPeriod(const RCP<ParameterList> &params)
   return params->get("Period", 1);
 }
 
+RCP<IncrementalPOD> createStreamingPOD(const RCP<ParameterList> &params)
+{
+  if (!useStreamingPOD(params)) {
+    return Teuchos::null;
+  }
+  const RCP<ParameterList> podParams = getStreamingPODParams(params);
+  const int maxRank = podParams->get("Basis Size", 0);
+  const double energyFraction = podParams->get("Energy Fraction", 1.0);
+  const double tolerance = podParams->get("Singular Value Tolerance", 1.0e-12);
+  return rcp(new IncrementalPOD(maxRank, energyFraction, tolerance));
+}
+
 std::string getGeneralizedCoordinatesFilename(const RCP<ParameterList> &params)
 {
   return params->get("Generalized Coordinates Output File Name", "generalized_coordinates.mtx");
@@ -106,7 +130,8 @@ RCP<NOX::Epetra::Observer> ObserverFactory::create(const RCP<NOX::Epetra::Observ
       const RCP<ParameterList> params = this->getSnapParameters();
       const RCP<MultiVectorOutputFile> snapOutputFile = createSnapshotOutputFile(params);
       const int period = getSnapshotPeriod(params);
-      composite->addObserver(rcp(new SnapshotCollectionObserver(period, snapOutputFile)));
+      const RCP<IncrementalPOD> pod = createStreamingPOD(params);
+      composite->addObserver(rcp(new SnapshotCollectionObserver(period, snapOutputFile, pod)));
     }
 
     if (this->computeProjectionError()) {
@@ -157,7 +182,8 @@ RCP<Rythmos::IntegrationObserverBase<double> > ObserverFactory::create(const RCP
       const RCP<ParameterList> params = this->getSnapParameters();
       const RCP<MultiVectorOutputFile> snapOutputFile = createSnapshotOutputFile(params);
       const int period = getSnapshotPeriod(params);
-      composite->addObserver(rcp(new RythmosSnapshotCollectionObserver(period, snapOutputFile)));
+      const RCP<IncrementalPOD> pod = createStreamingPOD(params);
+      composite->addObserver(rcp(new RythmosSnapshotCollectionObserver(period, snapOutputFile, pod)));
       ++observersInComposite;
     }
 
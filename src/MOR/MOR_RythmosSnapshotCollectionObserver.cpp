@@ -22,8 +22,9 @@ using ::Teuchos::ParameterList;
 
 RythmosSnapshotCollectionObserver::RythmosSnapshotCollectionObserver(
     int period,
-    Teuchos::RCP<MultiVectorOutputFile> snapshotFile) :
-  snapshotCollector_(period, snapshotFile)
+    Teuchos::RCP<MultiVectorOutputFile> snapshotFile,
+    const Teuchos::RCP<IncrementalPOD> &pod) :
+  snapshotCollector_(period, snapshotFile, pod)
 {
   // Nothing to do
 }
@@ -13,12 +13,14 @@
 namespace MOR {
 
 class MultiVectorOutputFile;
+class IncrementalPOD;
 
 class RythmosSnapshotCollectionObserver : public Rythmos::IntegrationObserverBase<double> {
 public:
   RythmosSnapshotCollectionObserver(
       int period,
-      Teuchos::RCP<MultiVectorOutputFile> snapshotFile);
+      Teuchos::RCP<MultiVectorOutputFile> snapshotFile,
+      const Teuchos::RCP<IncrementalPOD> &pod = Teuchos::null);
 
   // Overridden
   virtual Teuchos::RCP<Rythmos::IntegrationObserverBase<double> > cloneIntegrationObserver() const;
@@ -6,6 +6,7 @@
 #include "MOR_SnapshotCollection.hpp"
 
 #include "MOR_MultiVectorOutputFile.hpp"
+#include "MOR_IncrementalPOD.hpp"
 
 #include "Teuchos_TestForException.hpp"
 
@@ -26,9 +27,33 @@ SnapshotCollection::SnapshotCollection(
       "period = " << period << ", should have period > 0");
 }
 
+SnapshotCollection::SnapshotCollection(
+    int period,
+    const Teuchos::RCP<MultiVectorOutputFile> &basisFile,
+    const Teuchos::RCP<IncrementalPOD> &pod) :
+  period_(period),
+  snapshotFile_(basisFile),
+  pod_(pod),
+  skipCount_(0)
+{
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      period <= 0,
+      std::out_of_range,
+      "period = " << period << ", should have period > 0");
+}
+
 // TODO: Avoid doing real work in destructor
 SnapshotCollection::~SnapshotCollection()
 {
+  if (Teuchos::nonnull(pod_))
+  {
+    if (Teuchos::nonnull(pod_->basis()))
+    {
+      snapshotFile_->write(*pod_->basis());
+    }
+    return;
+  }
+
   const int vectorCount = snapshots_.size();
   if (vectorCount > 0)
   {
@@ -49,7 +74,14 @@ void SnapshotCollection::addVector(double stamp, const Epetra_Vector &value)
   if (skipCount_ == 0)
   {
     stamps_.push_back(stamp);
-    snapshots_.push_back(value);
+    if (Teuchos::nonnull(pod_))
+    {
+      pod_->addVector(value);
+    }
+    else
+    {
+      snapshots_.push_back(value);
+    }
     skipCount_ = period_ - 1;
   }
   else
@@ -15,19 +15,29 @@
 namespace MOR {
 
 class MultiVectorOutputFile;
+class IncrementalPOD;
 
+// Collects every period-th vector and writes them at destruction.
+// In streaming mode, the vectors are folded into an incremental POD instead
+// of being retained, and its basis is written in their place.
 class SnapshotCollection {
 public:
   SnapshotCollection(
       int period,
       const Teuchos::RCP<MultiVectorOutputFile> &snapshotFile);
 
+  SnapshotCollection(
+      int period,
+      const Teuchos::RCP<MultiVectorOutputFile> &basisFile,
+      const Teuchos::RCP<IncrementalPOD> &pod);
+
   ~SnapshotCollection();
   void addVector(double stamp, const Epetra_Vector &value);
 
 private:
   int period_;
   Teuchos::RCP<MultiVectorOutputFile> snapshotFile_;
+  Teuchos::RCP<IncrementalPOD> pod_;
 
   int skipCount_;
   std::deque<double> stamps_;
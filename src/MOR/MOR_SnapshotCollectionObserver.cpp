@@ -9,8 +9,9 @@ namespace MOR {
 
 SnapshotCollectionObserver::SnapshotCollectionObserver(
     int period,
-    const Teuchos::RCP<MultiVectorOutputFile> &snapshotFile) :
-  snapshotCollector_(period, snapshotFile)
+    const Teuchos::RCP<MultiVectorOutputFile> &snapshotFile,
+    const Teuchos::RCP<IncrementalPOD> &pod) :
+  snapshotCollector_(period, snapshotFile, pod)
 {
    // Nothing to do
 }
@@ -15,13 +15,15 @@
 namespace MOR {
 
 class MultiVectorOutputFile;
+class IncrementalPOD;
 
 class SnapshotCollectionObserver : public NOX::Epetra::Observer
 {
 public:
   SnapshotCollectionObserver(
       int period,
-      const Teuchos::RCP<MultiVectorOutputFile> &snapshotFile);
+      const Teuchos::RCP<MultiVectorOutputFile> &snapshotFile,
+      const Teuchos::RCP<IncrementalPOD> &pod = Teuchos::null);
 
   virtual void observeSolution(const Epetra_Vector& solution);
   virtual void observeSolution(const Epetra_Vector& solution, double time_or_param_val);
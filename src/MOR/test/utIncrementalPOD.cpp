@@ -0,0 +1,193 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+#include "MOR_IncrementalPOD.hpp"
+
+#include "Epetra_LAPACK.h"
+#include "Epetra_LocalMap.h"
+#include "Epetra_Map.h"
+#include "Epetra_MultiVector.h"
+#include "Epetra_SerialComm.h"
+#include "Epetra_Vector.h"
+
+#include "Teuchos_Array.hpp"
+#include "Teuchos_GlobalMPISession.hpp"
+#include "Teuchos_Tuple.hpp"
+#include "Teuchos_UnitTestHarness.hpp"
+#include "Teuchos_UnitTestRepository.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+const int rowCount = 40;
+const int snapshotCount = 12;
+
+// Snapshots sum_k amplitude_k * c_k(j) * phi_k with orthonormal discrete sine
+// modes phi_k and orthogonal cosine coefficients c_k, so that the singular
+// values are known in closed form: amplitude_k * sqrt(snapshotCount / 2).
+Teuchos::RCP<Epetra_MultiVector> createSnapshots(const Epetra_Map &map, Teuchos::ArrayView<const double> amplitudes)
+{
+  const double pi = std::acos(-1.0);
+  const Teuchos::RCP<Epetra_MultiVector> result(new Epetra_MultiVector(map, snapshotCount, true));
+  for (int j = 0; j < snapshotCount; ++j) {
+    for (int k = 0; k < amplitudes.size(); ++k) {
+      const double coefficient = amplitudes[k] * std::cos(pi * (k + 1) * (j + 0.5) / snapshotCount);
+      for (int i = 0; i < rowCount; ++i) {
+        const double mode = std::sqrt(2.0 / (rowCount + 1)) * std::sin(pi * (k + 1) * (i + 1) / (rowCount + 1));
+        (*result)[j][i] += coefficient * mode;
+      }
+    }
+  }
+  return result;
+}
+
+// Reference POD: left singular vectors of the whole snapshot matrix at once
+void computeBatchPOD(const Epetra_MultiVector &snapshots, Epetra_MultiVector &leftVectors, Teuchos::Array<double> &sigma)
+{
+  const int m = snapshots.MyLength();
+  const int n = snapshots.NumVectors();
+
+  Teuchos::Array<double> matrix(m * n);
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < m; ++i) {
+      matrix[i + j * m] = snapshots[j][i];
+    }
+  }
+
+  sigma.resize(std::min(m, n));
+  Teuchos::Array<double> u(m * n);
+  int lwork = 8 * (m + n);
+  Teuchos::Array<double> work(lwork);
+  double dummyVT;
+  int info;
+  Epetra_LAPACK().GESVD('S', 'N', m, n, matrix.getRawPtr(), m,
+      sigma.getRawPtr(), u.getRawPtr(), m, &dummyVT, 1,
+      work.getRawPtr(), &lwork, &info);
+  TEUCHOS_TEST_FOR_EXCEPTION(info != 0, std::runtime_error, "GESVD failed with info = " << info);
+
+  for (int j = 0; j < leftVectors.NumVectors(); ++j) {
+    for (int i = 0; i < m; ++i) {
+      leftVectors[j][i] = u[i + j * m];
+    }
+  }
+}
+
+// Largest norm of the component of the reference vectors outside span(basis)
+double subspaceDistance(const Epetra_MultiVector &basis, const Epetra_MultiVector &reference)
+{
+  const Epetra_LocalMap componentMap(basis.NumVectors(), 0, basis.Comm());
+  Epetra_MultiVector components(componentMap, reference.NumVectors(), false);
+  components.Multiply('T', 'N', 1.0, basis, reference, 0.0);
+
+  Epetra_MultiVector residual(reference);
+  residual.Multiply('N', 'N', -1.0, basis, components, 1.0);
+
+  Teuchos::Array<double> norms(reference.NumVectors());
+  residual.Norm2(norms.getRawPtr());
+  return *std::max_element(norms.begin(), norms.end());
+}
+
+void stream(const Epetra_MultiVector &snapshots, MOR::IncrementalPOD &pod)
+{
+  for (int j = 0; j < snapshots.NumVectors(); ++j) {
+    pod.addVector(*snapshots(j));
+  }
+}
+
+TEUCHOS_UNIT_TEST(MOR_IncrementalPOD, MatchesBatchPOD)
+{
+  const Epetra_SerialComm comm;
+  const Epetra_Map map(rowCount, 0, comm);
+  const Teuchos::Array<double> amplitudes = Teuchos::tuple(5.0, 3.0, 2.0, 1.0);
+  const Teuchos::RCP<Epetra_MultiVector> snapshots = createSnapshots(map, amplitudes());
+
+  Epetra_MultiVector batchBasis(map, 4, false);
+  Teuchos::Array<double> batchSigma;
+  computeBatchPOD(*snapshots, batchBasis, batchSigma);
+
+  MOR::IncrementalPOD pod(0, 1.0, 1.0e-10);
+  stream(*snapshots, pod);
+
+  // The snapshots span exactly four directions, later vectors must be dropped
+  TEST_EQUALITY(pod.vectorCount(), snapshotCount);
+  TEST_EQUALITY(pod.rank(), 4);
+  TEST_ASSERT(pod.discardedEnergyFraction() < 1.0e-12);
+
+  for (int k = 0; k < pod.rank(); ++k) {
+    TEST_FLOATING_EQUALITY(pod.singularValues()[k], batchSigma[k], 1.0e-10);
+    TEST_FLOATING_EQUALITY(pod.singularValues()[k], amplitudes[k] * std::sqrt(0.5 * snapshotCount), 1.0e-10);
+  }
+
+  TEST_ASSERT(subspaceDistance(*pod.basis(), batchBasis) < 1.0e-10);
+  TEST_ASSERT(subspaceDistance(batchBasis, *pod.basis()) < 1.0e-10);
+}
+
+TEUCHOS_UNIT_TEST(MOR_IncrementalPOD, RankTruncation)
+{
+  const Epetra_SerialComm comm;
+  const Epetra_Map map(rowCount, 0, comm);
+  const Teuchos::Array<double> amplitudes = Teuchos::tuple(100.0, 10.0, 0.01);
+  const Teuchos::RCP<Epetra_MultiVector> snapshots = createSnapshots(map, amplitudes());
+
+  Epetra_MultiVector batchBasis(map, 2, false);
+  Teuchos::Array<double> batchSigma;
+  computeBatchPOD(*snapshots, batchBasis, batchSigma);
+
+  MOR::IncrementalPOD pod(2, 1.0, 1.0e-10);
+  stream(*snapshots, pod);
+
+  TEST_EQUALITY(pod.rank(), 2);
+  TEST_EQUALITY(pod.basis()->NumVectors(), 2);
+  TEST_ASSERT(subspaceDistance(*pod.basis(), batchBasis) < 1.0e-3);
+  for (int k = 0; k < pod.rank(); ++k) {
+    TEST_FLOATING_EQUALITY(pod.singularValues()[k], batchSigma[k], 1.0e-6);
+  }
+
+  // Only the third mode is lost
+  const double expectedDiscarded = (0.01 * 0.01) / (100.0 * 100.0 + 10.0 * 10.0 + 0.01 * 0.01);
+  TEST_ASSERT(pod.discardedEnergyFraction() <= 2.0 * expectedDiscarded);
+}
+
+TEUCHOS_UNIT_TEST(MOR_IncrementalPOD, EnergyTruncation)
+{
+  const Epetra_SerialComm comm;
+  const Epetra_Map map(rowCount, 0, comm);
+  const Teuchos::Array<double> amplitudes = Teuchos::tuple(100.0, 10.0, 0.01);
+  const Teuchos::RCP<Epetra_MultiVector> snapshots = createSnapshots(map, amplitudes());
+
+  Epetra_MultiVector batchBasis(map, 2, false);
+  Teuchos::Array<double> batchSigma;
+  computeBatchPOD(*snapshots, batchBasis, batchSigma);
+
+  // The leading mode alone holds 99% of the energy, the first two more than 99.9999%
+  {
+    const double energyFraction = 0.999;
+    MOR::IncrementalPOD pod(0, energyFraction, 1.0e-10);
+    stream(*snapshots, pod);
+
+    TEST_EQUALITY(pod.rank(), 2);
+    TEST_ASSERT(pod.discardedEnergyFraction() <= 1.0 - energyFraction);
+    TEST_ASSERT(subspaceDistance(*pod.basis(), batchBasis) < 1.0e-3);
+  }
+  {
+    const double energyFraction = 0.9;
+    MOR::IncrementalPOD pod(0, energyFraction, 1.0e-10);
+    stream(*snapshots, pod);
+
+    TEST_EQUALITY(pod.rank(), 1);
+    TEST_ASSERT(pod.discardedEnergyFraction() <= 1.0 - energyFraction);
+    TEST_ASSERT(subspaceDistance(*pod.basis(), *batchBasis(0)) < 1.0e-3);
+  }
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+  Teuchos::GlobalMPISession mpiSession(&argc, &argv);
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
@@ -0,0 +1,609 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+// Micro-benchmark of the residual and Jacobian fills.
+//
+// Builds an Albany::Application for each canonical problem of
+// tests/large/PerformanceTests on a mesh generated in memory, times
+// computeGlobalResidualT and computeGlobalJacobianT over many repetitions and
+// reports the throughput in cells per second with its spread. With --profile
+// the time of the profiled evaluators is reported as well (see "Profile
+// Evaluators").
+// With --check-threads=N the fills are repeated on an Application using N
+// "Workset Threads" and compared with the serial ones. With --threads=1,2,4
+// every case is timed at each of these "Workset Threads" counts and the
+// speedup over the first count is reported.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Albany_Application.hpp"
+#include "Albany_DataTypes.hpp"
+#include "Albany_Memory.hpp"
+#include "Albany_Utils.hpp"
+#include "Albany_WorksetThreads.hpp"
+
+#include "PHAL_ProfiledEvaluator.hpp"
+
+#include "Teuchos_CommandLineProcessor.hpp"
+#include "Teuchos_CommHelpers.hpp"
+#include "Teuchos_FancyOStream.hpp"
+#include "Teuchos_GlobalMPISession.hpp"
+#include "Teuchos_ParameterList.hpp"
+#include "Teuchos_StandardCatchMacros.hpp"
+#include "Teuchos_VerboseObject.hpp"
+#include "Teuchos_XMLParameterListHelpers.hpp"
+
+#include "Kokkos_Core.hpp"
+
+#include "utility/DisplayTable.hpp"
+
+#if defined(ALBANY_APF)
+#include "Albany_APFMeshStruct.hpp"
+#endif
+
+// Global variable that denotes this is the Tpetra executable
+bool TpetraBuild = true;
+
+namespace {
+
+typedef Teuchos::RCP<Teuchos::ParameterList> ParamsPtr;
+
+//! Number of elements along one direction, at least 1.
+int elements (int n, double scale)
+{
+  return std::max(1, static_cast<int>(std::lround(n*scale)));
+}
+
+//! Mesh generated by STK2D or STK3D with n1 x n2 (x n3) elements.
+void generatedMesh (Teuchos::ParameterList& disc, int dim, double scale,
+                    int n1, int n2, int n3, int worksetSize)
+{
+  disc.set("Method", dim == 2 ? "STK2D" : "STK3D");
+  disc.set("1D Elements", elements(n1, scale));
+  disc.set("2D Elements", elements(n2, scale));
+  if (dim == 3) disc.set("3D Elements", elements(n3, scale));
+  disc.set("Workset Size", worksetSize);
+}
+
+//! tests/large/PerformanceTests/SteadyHeat2D
+ParamsPtr steadyHeat2D (double scale, int worksetSize)
+{
+  ParamsPtr params = Teuchos::rcp(new Teuchos::ParameterList("Albany Parameters"));
+  Teuchos::ParameterList& problem = params->sublist("Problem");
+  problem.set("Name", "Heat 2D");
+  Teuchos::ParameterList& dbcs = problem.sublist("Dirichlet BCs");
+  dbcs.set("DBC on NS NodeSet0 for DOF T", 1.5);
+  dbcs.set("DBC on NS NodeSet1 for DOF T", 1.0);
+  dbcs.set("DBC on NS NodeSet2 for DOF T", 1.0);
+  dbcs.set("DBC on NS NodeSet3 for DOF T", 1.0);
+  problem.sublist("Source Functions").sublist("Quadratic")
+    .set("Nonlinear Factor", 3.4);
+
+  Teuchos::ParameterList& disc = params->sublist("Discretization");
+  generatedMesh(disc, 2, scale, 200, 250, 0, worksetSize);
+  disc.set("Cubature Degree", 7);
+  return params;
+}
+
+//! Materials of the LCM cases, written next to the executable's output.
+std::string writeMaterials (const std::string& name,
+                            const Teuchos::ParameterList& material,
+                            const Teuchos::ParameterList& block,
+                            const Teuchos_Comm& comm)
+{
+  Teuchos::ParameterList materials;
+  materials.sublist("ElementBlocks").sublist("Block0") = block;
+  materials.sublist("ElementBlocks").sublist("Block0")
+    .set("material", name);
+  materials.sublist("Materials").sublist(name) = material;
+
+  const std::string filename = "benchmark_" + name + "_materials.xml";
+  if (comm.getRank() == 0)
+    Teuchos::writeParameterListToXmlFile(materials, filename);
+  comm.barrier();
+  return filename;
+}
+
+void constantProperty (Teuchos::ParameterList& material,
+                       const std::string& name, double value)
+{
+  Teuchos::ParameterList& p = material.sublist(name);
+  p.set(name + " Type", "Constant");
+  p.set("Value", value);
+}
+
+//! Mechanics 3D pulled along x on a generated hex mesh.
+ParamsPtr mechanics3D (const std::string& filename, double scale,
+                       int worksetSize, int n1, int n2, int n3)
+{
+  ParamsPtr params = Teuchos::rcp(new Teuchos::ParameterList("Albany Parameters"));
+  Teuchos::ParameterList& problem = params->sublist("Problem");
+  problem.set("Name", "Mechanics 3D");
+  problem.set("MaterialDB Filename", filename);
+  Teuchos::ParameterList& dbcs = problem.sublist("Dirichlet BCs");
+  dbcs.set("DBC on NS NodeSet0 for DOF X", 0.0);
+  dbcs.set("DBC on NS NodeSet2 for DOF Y", 0.0);
+  dbcs.set("DBC on NS NodeSet4 for DOF Z", 0.0);
+  dbcs.set("DBC on NS NodeSet1 for DOF X", 0.01);
+
+  generatedMesh(params->sublist("Discretization"), 3, scale,
+                n1, n2, n3, worksetSize);
+  return params;
+}
+
+//! tests/large/PerformanceTests/Necking3D: RIHMR with averaged J
+ParamsPtr necking3D (double scale, int worksetSize, const Teuchos_Comm& comm)
+{
+  Teuchos::ParameterList material;
+  material.sublist("Material Model").set("Model Name", "RIHMR");
+  constantProperty(material, "Elastic Modulus", 28.0e6);
+  constantProperty(material, "Poissons Ratio", 0.27);
+  constantProperty(material, "Hardening Modulus", 2.86614e5);
+  constantProperty(material, "Yield Strength", 50000.0);
+  constantProperty(material, "Recovery Modulus", 1.5);
+
+  Teuchos::ParameterList block;
+  block.set("Weighted Volume Average J", true);
+  block.set("Average J Stabilization Parameter", 0.05);
+
+  return mechanics3D(writeMaterials("SS304L", material, block, comm),
+                     scale, worksetSize, 24, 24, 24);
+}
+
+//! tests/large/PerformanceTests/NotchedTensionTet10: J2 with averaged
+//! pressure
+ParamsPtr notchedTension (double scale, int worksetSize,
+                          const Teuchos_Comm& comm)
+{
+  Teuchos::ParameterList material;
+  material.sublist("Material Model").set("Model Name", "J2");
+  constantProperty(material, "Elastic Modulus", 1000.0);
+  constantProperty(material, "Poissons Ratio", 0.25);
+  constantProperty(material, "Hardening Modulus", 100.0);
+  constantProperty(material, "Yield Strength", 10.0);
+
+  Teuchos::ParameterList block;
+  block.set("Weighted Volume Average J", true);
+  block.set("Average J Stabilization Parameter", 0.0);
+  block.set("Volume Average Pressure", true);
+
+  return mechanics3D(writeMaterials("TestMat2", material, block, comm),
+                     scale, worksetSize, 16, 16, 48);
+}
+
+//! One material model at small strain on the same mesh, so that the serial
+//! models and their parallel kernels can be compared per model.
+ParamsPtr materialModel (const std::string& model, double scale,
+                         int worksetSize, const Teuchos_Comm& comm)
+{
+  Teuchos::ParameterList material;
+  material.sublist("Material Model").set("Model Name", model);
+  constantProperty(material, "Elastic Modulus", 1000.0);
+  constantProperty(material, "Poissons Ratio", 0.25);
+  if (model == "J2" || model == "Parallel J2") {
+    constantProperty(material, "Hardening Modulus", 100.0);
+    constantProperty(material, "Yield Strength", 10.0);
+  } else {
+    material.set("Damage saturation", 1.0);
+    material.set("Maximum damage", 0.5);
+  }
+
+  Teuchos::ParameterList block;
+  if (model == "Elastic Damage" || model == "Parallel Elastic Damage")
+    block.set("Strain Flag", true);
+
+  std::string name = model;
+  name.erase(std::remove(name.begin(), name.end(), ' '), name.end());
+  return mechanics3D(writeMaterials(name, material, block, comm),
+                     scale, worksetSize, 24, 24, 24);
+}
+
+//! tests/large/PerformanceTests/FELIX_FO_MMS
+ParamsPtr felixFOMMS (double scale, int worksetSize)
+{
+  ParamsPtr params = Teuchos::rcp(new Teuchos::ParameterList("Albany Parameters"));
+  Teuchos::ParameterList& problem = params->sublist("Problem");
+  problem.set("Name", "FELIX Stokes First Order 3D");
+  Teuchos::ParameterList& dbcs = problem.sublist("Dirichlet BCs");
+  dbcs.set("DBC on NS NodeSet4 for DOF U0", 0.0);
+  dbcs.set("DBC on NS NodeSet5 for DOF U0", 0.0);
+  dbcs.set("DBC on NS NodeSet4 for DOF U1", 0.0);
+  dbcs.set("DBC on NS NodeSet5 for DOF U1", 0.0);
+  problem.sublist("FELIX Viscosity").set("Type", "Constant");
+  problem.sublist("Body Force").set("Type", "FOSinCosZ");
+
+  Teuchos::ParameterList& disc = params->sublist("Discretization");
+  generatedMesh(disc, 3, scale, 32, 27, 32, worksetSize);
+  disc.set("Periodic_x BC", true);
+  disc.set("Periodic_y BC", true);
+  return params;
+}
+
+struct Case {
+  std::string name;
+  std::function<ParamsPtr(double, int, const Teuchos_Comm&)> params;
+};
+
+std::vector<Case> cases ()
+{
+  std::vector<Case> all;
+  all.push_back({"SteadyHeat2D",
+      [](double s, int ws, const Teuchos_Comm&) { return steadyHeat2D(s, ws); }});
+#if defined(ALBANY_LCM)
+  all.push_back({"Necking3D", necking3D});
+  all.push_back({"NotchedTensionTet10", notchedTension});
+  for (const std::string model : {"J2", "Parallel J2", "Elastic Damage",
+                                  "Parallel Elastic Damage"}) {
+    std::string name = model;
+    name.erase(std::remove(name.begin(), name.end(), ' '), name.end());
+    all.push_back({name,
+        [model](double s, int ws, const Teuchos_Comm& comm) {
+          return materialModel(model, s, ws, comm);
+        }});
+  }
+#endif
+#if defined(ALBANY_FELIX)
+  all.push_back({"FELIX_FO_MMS",
+      [](double s, int ws, const Teuchos_Comm&) { return felixFOMMS(s, ws); }});
+#endif
+  return all;
+}
+
+//! Spread of the repetitions of one fill; times are the slowest rank's.
+struct Sample {
+  double mean;
+  double stddev;
+  double min;
+};
+
+Sample timeFill (const std::function<void()>& fill, int warmup,
+                 int repetitions, const Teuchos_Comm& comm,
+                 const std::function<void()>& afterWarmup)
+{
+  for (int i = 0; i < warmup; ++i) fill();
+  afterWarmup();
+
+  std::vector<double> seconds(repetitions);
+  for (int i = 0; i < repetitions; ++i) {
+    comm.barrier();
+    const auto start = std::chrono::steady_clock::now();
+    fill();
+    const std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+    const double local = elapsed.count();
+    Teuchos::reduceAll(comm, Teuchos::REDUCE_MAX, 1, &local, &seconds[i]);
+  }
+
+  Sample sample;
+  sample.mean = 0.0;
+  for (double t : seconds) sample.mean += t;
+  sample.mean /= repetitions;
+  double var = 0.0;
+  for (double t : seconds) var += (t - sample.mean)*(t - sample.mean);
+  sample.stddev = repetitions > 1 ? std::sqrt(var/(repetitions - 1)) : 0.0;
+  sample.min = *std::min_element(seconds.begin(), seconds.end());
+  return sample;
+}
+
+//! Largest entry of |a - b| relative to the largest entry of |a|.
+double relativeDifference (const Tpetra_Vector& a, const Tpetra_Vector& b)
+{
+  Tpetra_Vector d(a, Teuchos::Copy);
+  d.update(-1.0, b, 1.0);
+  const double scale = a.normInf();
+  return scale > 0.0 ? d.normInf()/scale : d.normInf();
+}
+
+//! Frobenius norm of a - b relative to that of a. Both matrices are filled
+//! on graphs built from the same discretization, so their rows hold the same
+//! columns in the same order.
+double relativeDifference (const Tpetra_CrsMatrix& a, const Tpetra_CrsMatrix& b)
+{
+  double local[2] = {0.0, 0.0};
+  for (LO row = 0; row < static_cast<LO>(a.getNodeNumRows()); ++row) {
+    Teuchos::ArrayView<const LO> a_cols, b_cols;
+    Teuchos::ArrayView<const ST> a_vals, b_vals;
+    a.getLocalRowView(row, a_cols, a_vals);
+    b.getLocalRowView(row, b_cols, b_vals);
+    const bool same_cols = a_cols.size() == b_cols.size() &&
+      std::equal(a_cols.begin(), a_cols.end(), b_cols.begin());
+    TEUCHOS_TEST_FOR_EXCEPTION(!same_cols, std::logic_error,
+        "Error! Row " << row << " of the threaded Jacobian has different "
+        "columns than the serial one.\n");
+    for (int k = 0; k < a_vals.size(); ++k) {
+      const double d = a_vals[k] - b_vals[k];
+      local[0] += d*d;
+      local[1] += a_vals[k]*a_vals[k];
+    }
+  }
+  double global[2];
+  Teuchos::reduceAll(*a.getComm(), Teuchos::REDUCE_SUM, 2, local, global);
+  const double diff = std::sqrt(global[0]), scale = std::sqrt(global[1]);
+  return scale > 0.0 ? diff/scale : diff;
+}
+
+//! Fill residual and Jacobian with the given Application and with one using
+//! num_threads "Workset Threads", and return the largest relative
+//! difference of the residuals and of the Jacobians.
+double compareThreadedFills (const Teuchos::RCP<Albany::Application>& app,
+                             const Teuchos::RCP<Teuchos::ParameterList>& params,
+                             const Teuchos::RCP<const Teuchos_Comm>& comm,
+                             int num_threads)
+{
+  const Teuchos::RCP<Teuchos::ParameterList> threaded_params =
+    Teuchos::rcp(new Teuchos::ParameterList(*params));
+  threaded_params->sublist("Problem").set("Workset Threads", num_threads);
+  const Teuchos::RCP<Albany::Application> threaded_app =
+    Teuchos::rcp(new Albany::Application(comm, threaded_params));
+
+  const Teuchos::RCP<const Tpetra_Vector> x =
+    app->getAdaptSolMgrT()->getInitialSolution()->getVector(0);
+  const Teuchos::Array<ParamVec> p;
+
+  Tpetra_Vector f(app->getMapT()), threaded_f(app->getMapT());
+  app->computeGlobalResidualT(0.0, NULL, NULL, *x, p, f);
+  threaded_app->computeGlobalResidualT(0.0, NULL, NULL, *x, p, threaded_f);
+  double diff = relativeDifference(f, threaded_f);
+
+  Tpetra_CrsMatrix jac(app->getJacobianGraphT());
+  Tpetra_CrsMatrix threaded_jac(threaded_app->getJacobianGraphT());
+  app->computeGlobalJacobianT(1.0, 0.0, 0.0, 0.0, NULL, NULL, *x, p,
+                              &f, jac);
+  threaded_app->computeGlobalJacobianT(1.0, 0.0, 0.0, 0.0, NULL, NULL, *x, p,
+                                       &threaded_f, threaded_jac);
+  diff = std::max(diff, relativeDifference(f, threaded_f));
+  diff = std::max(diff, relativeDifference(jac, threaded_jac));
+  return diff;
+}
+
+//! "1,2,4" -> {1, 2, 4}; empty if an entry is not a positive integer.
+std::vector<int> threadCounts (const std::string& list)
+{
+  std::vector<int> counts;
+  std::istringstream in(list);
+  std::string entry;
+  while (std::getline(in, entry, ',')) {
+    std::istringstream value(entry);
+    int n = 0;
+    if (!(value >> n) || !value.eof() || n < 1) return std::vector<int>();
+    counts.push_back(n);
+  }
+  return counts;
+}
+
+}
+
+int
+main(int argc, char *argv[]) {
+  int status = 0;  // 0 = pass, failures are incremented
+  bool success = true;
+
+  Teuchos::GlobalMPISession mpiSession(&argc, &argv);
+  Kokkos::initialize(argc, argv);
+
+#if defined(ALBANY_APF)
+  Albany::APFMeshStruct::initialize_libraries(&argc, &argv);
+#endif
+
+  using Teuchos::RCP;
+  using Teuchos::rcp;
+
+  RCP<Teuchos::FancyOStream> out(
+      Teuchos::VerboseObjectBase::getDefaultOStream());
+
+  Teuchos::CommandLineProcessor clp;
+  clp.setDocString(
+      "Residual and Jacobian fill benchmark on generated meshes.\n"
+      "Reports cells per second of each fill, averaged over the repetitions.\n");
+
+  std::string problem = "all";
+  clp.setOption("problem", &problem,
+      "SteadyHeat2D, Necking3D, NotchedTensionTet10, J2, ParallelJ2,\n"
+      "ElasticDamage, ParallelElasticDamage, FELIX_FO_MMS or all");
+  int repetitions = 20;
+  clp.setOption("repetitions", &repetitions, "Timed fills per kernel");
+  int warmup = 2;
+  clp.setOption("warmup", &warmup, "Untimed fills before the timed ones");
+  double scale = 1.0;
+  clp.setOption("scale", &scale, "Factor on the elements per direction");
+  int worksetSize = 100;
+  clp.setOption("wsize", &worksetSize, "Workset Size");
+  bool jacobian = true;
+  clp.setOption("jacobian", "no-jacobian", &jacobian, "Time the Jacobian fill");
+  bool profile = false;
+  clp.setOption("profile", "no-profile", &profile,
+      "Report the time of every evaluator");
+  bool json = false;
+  clp.setOption("json", "table", &json, "Write the results as JSON");
+  int checkThreads = 1;
+  clp.setOption("check-threads", &checkThreads,
+      "Compare the fills with those of this many Workset Threads (1: no check)");
+  std::string threads = "1";
+  clp.setOption("threads", &threads,
+      "Comma separated Workset Threads counts to time every case with");
+
+  clp.throwExceptions(false);
+  const Teuchos::CommandLineProcessor::EParseCommandLineReturn parse_return =
+    clp.parse(argc, argv);
+  if (parse_return == Teuchos::CommandLineProcessor::PARSE_HELP_PRINTED) {
+    Kokkos::finalize_all();
+    return 0;
+  }
+  if (parse_return != Teuchos::CommandLineProcessor::PARSE_SUCCESSFUL ||
+      repetitions < 1 || warmup < 0 || scale <= 0.0 || checkThreads < 1 ||
+      threadCounts(threads).empty()) {
+    *out << "AlbanyBenchmark: bad command line, see --help\n";
+    Kokkos::finalize_all();
+    return 1;
+  }
+
+  // Builds that cannot run Workset Threads skip the comparison (ctest
+  // SKIP_RETURN_CODE)
+  const int skipped = 77;
+  if (checkThreads > 1) {
+    try {
+      Albany::checkWorksetThreadsSupported(checkThreads);
+    } catch (const std::logic_error& e) {
+      *out << "AlbanyBenchmark: skipping --check-threads: " << e.what();
+      Kokkos::finalize_all();
+      return skipped;
+    }
+  }
+
+  try {
+    const RCP<const Teuchos_Comm> comm =
+        Tpetra::DefaultPlatform::getDefaultPlatform().getComm();
+
+    PHAL::EvaluatorProfiler& profiler = PHAL::EvaluatorProfiler::instance();
+    if (profile) profiler.enable(json ? "JSON" : "Table");
+
+    // Thread counts this build cannot run are left out of the scaling
+    std::vector<int> counts;
+    for (const int n : threadCounts(threads)) {
+      try {
+        if (n > 1) Albany::checkWorksetThreadsSupported(n);
+        counts.push_back(n);
+      } catch (const std::logic_error& e) {
+        *out << "AlbanyBenchmark: skipping --threads=" << n << ": "
+             << e.what();
+      }
+    }
+    TEUCHOS_TEST_FOR_EXCEPTION(counts.empty(), std::logic_error,
+        "Error! None of the --threads counts " << threads
+        << " can run in this build.\n");
+
+    util::DisplayTable table;
+    table.addRow("Problem", "Fill", "Threads", "Cells", "Repetitions",
+                 "Mean [s]", "Std Dev [s]", "Min [s]", "Cells/s",
+                 "Cells/s Std Dev", "Speedup");
+    std::vector<std::string> records;
+
+    bool found = false;
+    for (const Case& c : cases()) {
+      if (problem != "all" && problem != c.name) continue;
+      found = true;
+
+      const RCP<Teuchos::ParameterList> params =
+        c.params(scale, worksetSize, *comm);
+      (void) Teuchos::sublist(params, "Debug Output");
+
+      // Mean time of each fill at the first thread count
+      std::vector<double> baseline;
+      for (const int numThreads : counts) {
+        profiler.clear();
+        const RCP<Teuchos::ParameterList> threaded_params =
+          rcp(new Teuchos::ParameterList(*params));
+        if (numThreads > 1)
+          threaded_params->sublist("Problem")
+            .set("Workset Threads", numThreads);
+        const RCP<Albany::Application> app =
+          rcp(new Albany::Application(comm, threaded_params));
+
+        // Cells of all worksets of all ranks
+        const Albany::AbstractDiscretization::Conn& wsElNodeEqID =
+          app->getDiscretization()->getWsElNodeEqID();
+        long local_cells = 0;
+        for (int ws = 0; ws < wsElNodeEqID.size(); ++ws)
+          local_cells += wsElNodeEqID[ws].dimension(0);
+        long cells = 0;
+        Teuchos::reduceAll(*comm, Teuchos::REDUCE_SUM, 1, &local_cells, &cells);
+
+        const RCP<const Tpetra_Vector> x =
+          app->getAdaptSolMgrT()->getInitialSolution()->getVector(0);
+        const RCP<Tpetra_Vector> f = rcp(new Tpetra_Vector(app->getMapT()));
+        const RCP<Tpetra_CrsMatrix> jac =
+          rcp(new Tpetra_CrsMatrix(app->getJacobianGraphT()));
+        const Teuchos::Array<ParamVec> p;
+
+        std::vector<std::pair<std::string, std::function<void()> > > fills;
+        fills.push_back({"Residual", [&]() {
+            app->computeGlobalResidualT(0.0, NULL, NULL, *x, p, *f);
+          }});
+        if (jacobian)
+          fills.push_back({"Jacobian", [&]() {
+              app->computeGlobalJacobianT(1.0, 0.0, 0.0, 0.0, NULL, NULL, *x,
+                                          p, f.get(), *jac);
+            }});
+
+        if (checkThreads > 1 && numThreads == counts.front()) {
+          const double diff =
+            compareThreadedFills(app, threaded_params, comm, checkThreads);
+          // Only the order of the sums into shared rows differs
+          const bool match = diff <= 1.0e-12;
+          *out << c.name << ": fills on " << checkThreads
+               << " workset threads differ from the serial ones by " << diff
+               << (match ? "" : " FAILED") << std::endl;
+          if (!match) ++status;
+        }
+
+        for (std::size_t i = 0; i < fills.size(); ++i) {
+          const auto& fill = fills[i];
+          const Sample s = timeFill(fill.second, warmup, repetitions, *comm,
+                                    [&]() { profiler.reset(); });
+          if (numThreads == counts.front()) baseline.push_back(s.mean);
+          const double speedup = baseline[i]/s.mean;
+          // Spread of the throughput to first order in the spread of the time
+          const double rate = cells/s.mean;
+          const double rate_stddev = rate*s.stddev/s.mean;
+          table.addRow(c.name, fill.first, numThreads, cells, repetitions,
+                       s.mean, s.stddev, s.min, rate, rate_stddev, speedup);
+
+          std::ostringstream record;
+          record << "  {\"problem\": \"" << c.name
+                 << "\", \"fill\": \"" << fill.first
+                 << "\", \"threads\": " << numThreads
+                 << ", \"cells\": " << cells
+                 << ", \"repetitions\": " << repetitions
+                 << ", \"mean\": " << s.mean
+                 << ", \"stddev\": " << s.stddev
+                 << ", \"min\": " << s.min
+                 << ", \"cells per second\": " << rate
+                 << ", \"cells per second stddev\": " << rate_stddev
+                 << ", \"speedup\": " << speedup << "}";
+          records.push_back(record.str());
+
+          if (profile) {
+            *out << "\n" << c.name << " " << fill.first << " on "
+                 << numThreads << " threads evaluator profile:\n";
+            profiler.summarize(comm.ptr(), *out);
+          }
+        }
+      }
+    }
+
+    TEUCHOS_TEST_FOR_EXCEPTION(!found, std::logic_error,
+        "Error! Unknown or disabled benchmark problem " << problem << ".\n");
+
+    if (comm->getRank() == 0) {
+      *out << "\n";
+      if (json) {
+        *out << "{\"benchmarks\": [";
+        for (std::size_t i = 0; i < records.size(); ++i)
+          *out << (i == 0 ? "\n" : ",\n") << records[i];
+        *out << "\n]}" << std::endl;
+      } else {
+        table.writeCSV(*out);
+      }
+    }
+  }
+  TEUCHOS_STANDARD_CATCH_STATEMENTS(true, std::cerr, success);
+  if (!success) status += 10000;
+
+#ifdef ALBANY_APF
+  Albany::APFMeshStruct::finalize_libraries();
+#endif
+
+  Kokkos::finalize_all();
+
+  return status;
+}
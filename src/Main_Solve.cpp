@@ -11,6 +11,8 @@
 #include "Albany_Utils.hpp"
 #include "Albany_SolverFactory.hpp"
 #include "Albany_Memory.hpp"
+#include "PHAL_ProfiledEvaluator.hpp"
+#include "utility/PerformanceContext.hpp"
 
 #include "Piro_PerformSolve.hpp"
 #include "Teuchos_ParameterList.hpp"
@@ -125,6 +127,7 @@ int main(int argc, char *argv[]) {
   int status=0; // 0 = pass, failures are incremented
   bool success = true;
 
+  Albany::initializeMPIThreads(&argc, &argv);
 #ifdef ALBANY_DEBUG
   Teuchos::GlobalMPISession mpiSession(&argc, &argv);
 #else // bypass printing process startup info
@@ -310,6 +313,11 @@ int main(int argc, char *argv[]) {
 
   Teuchos::TimeMonitor::summarize(*out,false,true,false/*zero timers*/);
 
+  // Written once, after the solve, however many Applications took part
+  if (PHAL::EvaluatorProfiler::instance().enabled())
+    util::PerformanceContext::instance().summarizeAll(
+        Tpetra::DefaultPlatform::getDefaultPlatform().getComm().ptr(), *out);
+
   Kokkos::finalize_all();
  
   return status;
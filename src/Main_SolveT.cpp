@@ -10,6 +10,8 @@
 #include "Albany_Memory.hpp"
 #include "Albany_SolverFactory.hpp"
 #include "Albany_Utils.hpp"
+#include "PHAL_ProfiledEvaluator.hpp"
+#include "utility/PerformanceContext.hpp"
 
 #include "Piro_PerformSolve.hpp"
 #include "Teuchos_ParameterList.hpp"
@@ -247,6 +249,7 @@ main(int argc, char *argv[]) {
   int status = 0;  // 0 = pass, failures are incremented
   bool success = true;
 
+  Albany::initializeMPIThreads(&argc, &argv);
   Teuchos::GlobalMPISession mpiSession(&argc, &argv);
   Kokkos::initialize(argc, argv);
 
@@ -575,6 +578,11 @@ main(int argc, char *argv[]) {
 
   Teuchos::TimeMonitor::summarize(*out, false, true, false /*zero timers*/);
 
+  // Written once, after the solve, however many Applications took part
+  if (PHAL::EvaluatorProfiler::instance().enabled())
+    util::PerformanceContext::instance().summarizeAll(
+        Tpetra::DefaultPlatform::getDefaultPlatform().getComm().ptr(), *out);
+
 #ifdef ALBANY_APF
   Albany::APFMeshStruct::finalize_libraries();
 #endif
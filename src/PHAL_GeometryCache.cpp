@@ -0,0 +1,39 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "PHAL_GeometryCache.hpp"
+
+namespace PHAL {
+
+GeometryCache::GeometryCache (bool referenceBF)
+  : referenceBF_(referenceBF), meshVersion_(-1)
+{
+}
+
+std::shared_ptr<GeometryCache::Entry>
+GeometryCache::get (int ws, const std::string& name)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::shared_ptr<Entry>& entry = entries_[std::make_pair(ws, name)];
+  if (!entry) entry = std::make_shared<Entry>();
+  return entry;
+}
+
+void GeometryCache::setMeshVersion (int meshVersion)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (meshVersion == meshVersion_) return;
+  entries_.clear();
+  meshVersion_ = meshVersion;
+}
+
+void GeometryCache::clear ()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.clear();
+}
+
+} // namespace PHAL
@@ -0,0 +1,69 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef PHAL_GEOMETRY_CACHE_HPP
+#define PHAL_GEOMETRY_CACHE_HPP
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include "Albany_DataTypes.hpp"
+#include "Kokkos_DynRankView.hpp"
+#include "Phalanx_KokkosDeviceTypes.hpp"
+
+namespace PHAL {
+
+/*! Basis functions and measures of the worksets of a static mesh.
+ *
+ * The Application owns the cache ("Cache Basis Functions") and hands it to
+ * the evaluators through Workset::geometryCache. Entries are shared by all
+ * evaluation types whose mesh scalar is RealType, and are dropped whenever
+ * the mesh version of the discretization changes (adaptation, coordinate
+ * updates) or when clear() is called (shape parameter changes).
+ */
+class GeometryCache {
+public:
+
+  //! If referenceBF, BF is rebuilt from the reference element values
+  //! instead of being kept per cell.
+  explicit GeometryCache(bool referenceBF);
+
+  bool referenceBF() const { return referenceBF_; }
+
+  struct Entry {
+    bool filled = false;
+    Kokkos::DynRankView<RealType, PHX::Device> weighted_measure;
+    Kokkos::DynRankView<RealType, PHX::Device> jacobian_det;
+    Kokkos::DynRankView<RealType, PHX::Device> BF;
+    Kokkos::DynRankView<RealType, PHX::Device> wBF;
+    Kokkos::DynRankView<RealType, PHX::Device> GradBF;
+    Kokkos::DynRankView<RealType, PHX::Device> wGradBF;
+  };
+
+  //! Entry of workset ws for the basis named name; not filled on first use.
+  //! Only one thread works on a given workset at a time.
+  std::shared_ptr<Entry> get(int ws, const std::string& name);
+
+  //! Drop all entries if meshVersion differs from the one they were built for.
+  void setMeshVersion(int meshVersion);
+
+  //! Drop all entries.
+  void clear();
+
+private:
+
+  bool referenceBF_;
+  int meshVersion_;
+  std::mutex mutex_;
+  std::map<std::pair<int, std::string>, std::shared_ptr<Entry> > entries_;
+};
+
+} // namespace PHAL
+
+#endif // PHAL_GEOMETRY_CACHE_HPP
@@ -9,6 +9,30 @@
 
 namespace PHAL {
 
+namespace {
+// With a static Fad type the derivative array length is fixed at configure
+// time. SFad<N> only works with exactly N derivative components; SLFad<N>
+// takes up to N. Reject other problems rather than let Sacado mis-size them.
+int checkStaticFadSize (const int deriv_dim) {
+#if defined(ALBANY_SFAD)
+  TEUCHOS_TEST_FOR_EXCEPTION(
+    deriv_dim != ALBANY_SFAD_SIZE, std::logic_error,
+    "Error: the Jacobian needs " << deriv_dim << " derivative components but"
+    " FadType is SFad<" << ALBANY_SFAD_SIZE << ">, which needs exactly "
+    << ALBANY_SFAD_SIZE << ". Reconfigure with -D SFAD_SIZE=" << deriv_dim
+    << ", or with ENABLE_SLFAD and SLFAD_SIZE >= " << deriv_dim << " to run"
+    " problems of several sizes from one build.\n");
+#elif defined(ALBANY_FAST_FELIX)
+  TEUCHOS_TEST_FOR_EXCEPTION(
+    deriv_dim > ALBANY_SLFAD_SIZE, std::logic_error,
+    "Error: the Jacobian needs " << deriv_dim << " derivative components but"
+    " FadType is SLFad<" << ALBANY_SLFAD_SIZE << ">. Reconfigure with"
+    " -D SLFAD_SIZE=" << deriv_dim << " or without ENABLE_SLFAD.\n");
+#endif
+  return deriv_dim;
+}
+}
+
 template<> int getDerivativeDimensions<PHAL::AlbanyTraits::Jacobian> (
   const Albany::Application* app, const Albany::MeshSpecsStruct* ms)
 {
@@ -20,10 +44,10 @@ template<> int getDerivativeDimensions<PHAL::AlbanyTraits::Jacobian> (
         int side_node_count = ms->ctd.side[2].topology->node_count;
         int node_count = ms->ctd.node_count;
         int numLevels = app->getDiscretization()->getLayeredMeshNumbering()->numLayers+1;
-        return app->getNumEquations()*(node_count + side_node_count*numLevels);
+        return checkStaticFadSize(app->getNumEquations()*(node_count + side_node_count*numLevels));
       }
   }
-  return app->getNumEquations() * ms->ctd.node_count;
+  return checkStaticFadSize(app->getNumEquations() * ms->ctd.node_count);
 }
 
 template<> int getDerivativeDimensions<PHAL::AlbanyTraits::Tangent> (
@@ -50,7 +74,7 @@ template<> int getDerivativeDimensions<PHAL::AlbanyTraits::Jacobian> (
       int side_node_count = app->getEnrichedMeshSpecs()[ebi].get()->ctd.side[2].topology->node_count;
       int node_count = app->getEnrichedMeshSpecs()[ebi].get()->ctd.node_count;
       int numLevels = app->getDiscretization()->getLayeredMeshNumbering()->numLayers+1;
-      return app->getNumEquations()*(node_count + side_node_count*numLevels);
+      return checkStaticFadSize(app->getNumEquations()*(node_count + side_node_count*numLevels));
     }
 #ifdef ALBANY_AERAS
     if ((problemName == "Aeras Hydrostatic")  && (explicit_scheme == true))
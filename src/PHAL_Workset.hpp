@@ -24,6 +24,8 @@
 #include "Albany_DistributedParameterLibrary.hpp"
 #include "Albany_DistributedParameterLibrary_Tpetra.hpp"
 #include "Kokkos_ViewFactory.hpp"
+#include "PHAL_WorksetScratch.hpp"
+#include "PHAL_GeometryCache.hpp"
 
 #ifdef ALBANY_STOKHOS
 #include "Stokhos_OrthogPolyExpansion.hpp"
@@ -52,7 +54,9 @@ namespace PHAL {
 struct Workset {
 
   Workset() :
-    transientTerms(false), accelerationTerms(false), ignore_residual(false) {}
+    stateHandleArrayPtr(NULL), stateHandlesPtr(NULL),
+    transientTerms(false), accelerationTerms(false), ignore_residual(false),
+    jacobian_diagonal_only(false) {}
 
   unsigned int numCells;
   unsigned int wsIndex;
@@ -173,8 +177,19 @@ struct Workset {
   std::vector<PHX::index_size_type> Tangent_deriv_dims;
 
   Albany::AbstractDiscretization::WorksetConn wsElNodeEqID;
+  // Offsets of the element Jacobian entries in the overlapped Jacobian
+  // values; empty if not precomputed by the discretization
+  Albany::AbstractDiscretization::WorksetJacOffsets wsJacOffsets;
   Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> >  wsElNodeID;
   Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*> >  wsCoords;
+  // Contiguous copy of wsCoords; empty if not packed by the discretization
+  Albany::AbstractDiscretization::WorksetCoords wsPackedCoords;
+  // Arena for evaluator temporaries, reset before each workset; null if
+  // the Application does not provide one
+  Teuchos::RCP<PHAL::WorksetScratch> scratch;
+  // Basis functions of a static mesh, kept across evaluations; null if the
+  // Application does not cache them
+  Teuchos::RCP<PHAL::GeometryCache> geometryCache;
   Teuchos::ArrayRCP<double>  wsSphereVolume;
   Teuchos::ArrayRCP<double*>  wsLatticeOrientation;
   Teuchos::ArrayRCP<Teuchos::ArrayRCP<Teuchos::ArrayRCP<Teuchos::ArrayRCP<double> > > >  ws_coord_derivs;
@@ -195,6 +210,10 @@ struct Workset {
 #endif
 
   Albany::StateArray* stateArrayPtr;
+  // The same states by StateManager handle, see getStateHandle(); null if
+  // the Application does not provide them
+  const Albany::StateHandleArray* stateHandleArrayPtr;
+  const Albany::StateHandles* stateHandlesPtr;
 #if defined(ALBANY_EPETRA)
   Teuchos::RCP<Albany::EigendataStruct> eigenDataPtr;
   Teuchos::RCP<Epetra_MultiVector> auxDataPtr;
@@ -217,6 +236,11 @@ struct Workset {
   // either the Jacobian or the transpose of the Jacobian is scattered.
   bool is_adjoint;
 
+  // Flag indicating that JacT only holds the diagonal (see
+  // Albany::Application::computeGlobalJacobianDiagonalT). Scatters may then
+  // skip the off-diagonal derivatives; any they sum in are dropped.
+  bool jacobian_diagonal_only;
+
   // New field manager response stuff
   Teuchos::RCP<const Teuchos::Comm<int> > comm;
 #if defined(ALBANY_EPETRA)
@@ -309,6 +333,26 @@ struct Workset {
 
 };
 
+//! Handle of the element state name, to resolve once and pass to
+//! getStateArray(); -1 if the workset has no handles or no such state.
+inline int getStateHandle(const Workset& workset, const std::string& name)
+{
+  if (workset.stateHandlesPtr == NULL) return -1;
+  const Albany::StateHandles::const_iterator it = workset.stateHandlesPtr->find(name);
+  return it == workset.stateHandlesPtr->end() ? -1 : it->second;
+}
+
+//! Element state of the workset, by handle if there is one and by name
+//! otherwise. A state the workset does not have is an empty (rank 0) array.
+inline const Albany::MDArray&
+getStateArray(const Workset& workset, const int handle, const std::string& name)
+{
+  if (handle >= 0 && workset.stateHandleArrayPtr != NULL &&
+      handle < static_cast<int>(workset.stateHandleArrayPtr->size()))
+    return (*workset.stateHandleArrayPtr)[handle];
+  return (*workset.stateArrayPtr)[name];
+}
+
 }
 
 #endif
@@ -0,0 +1,107 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include <mutex>
+
+#include "PHAL_WorksetScratch.hpp"
+#include "utility/PerformanceContext.hpp"
+
+namespace PHAL {
+
+namespace {
+// The user names and the counter monitor are shared by the arenas of all
+// workset threads
+std::mutex registry_mutex;
+std::vector<std::string> user_names;
+}
+
+WorksetScratch::WorksetScratch (std::size_t size)
+  : allocator_(size), reportedHighWater_(0), peaksGrew_(false)
+{
+}
+
+WorksetScratch::~WorksetScratch ()
+{
+  destroyFrom(0);
+  if (peaksGrew_) reportPeaks();
+}
+
+int WorksetScratch::registerUser (const std::string& name)
+{
+  std::lock_guard<std::mutex> lock(registry_mutex);
+  user_names.push_back(name);
+  return user_names.size() - 1;
+}
+
+void WorksetScratch::reset ()
+{
+  destroyFrom(0);
+  allocator_.clear();
+  if (peaksGrew_) reportPeaks();
+}
+
+void WorksetScratch::destroyFrom (std::size_t first)
+{
+  while (destructors_.size() > first) {
+    const Destructor& d = destructors_.back();
+    d.destroy(d.ptr, d.n);
+    destructors_.pop_back();
+  }
+}
+
+void WorksetScratch::recordPeak (int user, std::size_t bytes)
+{
+  if (user >= static_cast<int>(peaks_.size())) peaks_.resize(user + 1, 0);
+  if (bytes > peaks_[user]) {
+    peaks_[user] = bytes;
+    peaksGrew_ = true;
+  }
+}
+
+void WorksetScratch::reportPeaks ()
+{
+  std::lock_guard<std::mutex> lock(registry_mutex);
+  util::CounterMonitor& counters =
+    util::PerformanceContext::instance().counterMonitor();
+
+  reportedPeaks_.resize(peaks_.size(), 0);
+  for (std::size_t user = 0; user < peaks_.size(); ++user) {
+    if (peaks_[user] <= reportedPeaks_[user]) continue;
+    reportedPeaks_[user] = peaks_[user];
+    util::Counter& counter = *counters["Scratch High Water: " + user_names[user]];
+    if (counter.value() < peaks_[user]) counter.set(peaks_[user]);
+  }
+
+  if (allocator_.highWater() > reportedHighWater_) {
+    reportedHighWater_ = allocator_.highWater();
+    util::Counter& counter = *counters["Scratch High Water"];
+    if (counter.value() < reportedHighWater_) counter.set(reportedHighWater_);
+  }
+  peaksGrew_ = false;
+}
+
+ScratchScope::ScratchScope (const Teuchos::RCP<WorksetScratch>& scratch,
+                            int user)
+  : scratch_(scratch.get()), user_(user), start_(0), destructorsStart_(0)
+{
+  if (scratch_ != nullptr) {
+    start_ = scratch_->allocator_.used();
+    destructorsStart_ = scratch_->destructors_.size();
+  }
+}
+
+ScratchScope::~ScratchScope ()
+{
+  if (scratch_ == nullptr) return;
+
+  // Allocations are strictly nested, so everything past start_ is ours
+  const std::size_t used = scratch_->allocator_.used();
+  scratch_->destroyFrom(destructorsStart_);
+  scratch_->allocator_.rewind(start_);
+  scratch_->recordPeak(user_, used - start_);
+}
+
+} // namespace PHAL
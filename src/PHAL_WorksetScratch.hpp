@@ -0,0 +1,131 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef PHAL_WORKSET_SCRATCH_HPP
+#define PHAL_WORKSET_SCRATCH_HPP
+
+#include <memory>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+#include "utility/StaticAllocator.hpp"
+
+namespace PHAL {
+
+/*! Bump arena for the temporaries of evaluators.
+ *
+ * The Application owns one arena per workset thread and hands it to the
+ * evaluators through Workset::scratch. Memory is taken with a ScratchScope
+ * and is returned when the scope ends; reset() reclaims everything at once
+ * before the next workset is loaded.
+ */
+class WorksetScratch {
+public:
+  //! Arena of size bytes.
+  explicit WorksetScratch(std::size_t size);
+  ~WorksetScratch();
+
+  //! Release all memory, running the destructors of what is still alive.
+  void reset();
+
+  //! Largest number of bytes in use at any time.
+  std::size_t highWater() const { return allocator_.highWater(); }
+
+  //! Slot of the evaluator named name in the peak usage of all arenas.
+  //! Call it once, at construction or in postRegistrationSetup.
+  static int registerUser(const std::string& name);
+
+private:
+  friend class ScratchScope;
+
+  struct Destructor {
+    void* ptr;
+    std::size_t n;
+    void (*destroy)(void*, std::size_t);
+  };
+
+  template<typename T>
+  static void destroy (void* ptr, std::size_t n) {
+    T* a = static_cast<T*>(ptr);
+    for (std::size_t i = 0; i < n; ++i) a[i].~T();
+  }
+
+  //! Run the destructors registered after position first.
+  void destroyFrom(std::size_t first);
+
+  //! Record the peak usage of a scope of user. The arena belongs to one
+  //! thread, so this takes no lock.
+  void recordPeak(int user, std::size_t bytes);
+
+  //! Report the peaks that grew since the last call to
+  //! util::PerformanceContext.
+  void reportPeaks();
+
+  utility::StaticAllocator allocator_;
+  std::vector<Destructor> destructors_;
+  std::vector<std::size_t> peaks_;
+  std::vector<std::size_t> reportedPeaks_;
+  std::size_t reportedHighWater_;
+  bool peaksGrew_;
+};
+
+/*! Scratch memory taken by one evaluator.
+ *
+ * \code
+ *    // In postRegistrationSetup
+ *    scratchUser = PHAL::WorksetScratch::registerUser(this->getName());
+ *    // In evaluateFields
+ *    PHAL::ScratchScope scratch(workset.scratch, scratchUser);
+ *    ScalarT* occ = scratch.allocate<ScalarT>(nEvals);
+ * \endcode
+ *
+ * Arrays live until the scope is destroyed. Without an arena, or when the
+ * arena is full, they are taken from the heap instead.
+ */
+class ScratchScope {
+public:
+  ScratchScope(const Teuchos::RCP<WorksetScratch>& scratch, int user);
+  ~ScratchScope();
+
+  ScratchScope(const ScratchScope&) = delete;
+  ScratchScope& operator=(const ScratchScope&) = delete;
+
+  //! n value-initialized T's.
+  template<typename T>
+  T* allocate(std::size_t n);
+
+private:
+  WorksetScratch* scratch_;
+  int user_;
+  std::size_t start_;
+  std::size_t destructorsStart_;
+  std::vector<std::shared_ptr<void> > heap_;
+};
+
+template<typename T>
+T* ScratchScope::allocate (std::size_t n) {
+  void* ptr = scratch_ == nullptr ? nullptr :
+    scratch_->allocator_.allocate(n*sizeof(T), alignof(T));
+
+  if (ptr == nullptr) {
+    T* a = new T[n]();
+    heap_.push_back(std::shared_ptr<void>(a, std::default_delete<T[]>()));
+    return a;
+  }
+
+  T* a = static_cast<T*>(ptr);
+  for (std::size_t i = 0; i < n; ++i) new (a + i) T();
+  if (!std::is_trivially_destructible<T>::value)
+    scratch_->destructors_.push_back({a, n, &WorksetScratch::destroy<T>});
+  return a;
+}
+
+} // namespace PHAL
+
+#endif // PHAL_WORKSET_SCRATCH_HPP
@@ -0,0 +1,239 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "QCAD_CoulombBatchSolver.hpp"
+#include "Albany_Utils.hpp"
+
+#include "Teuchos_TestForException.hpp"
+#include "Teuchos_VerboseObject.hpp"
+
+#include <algorithm>
+
+#include <BelosLinearProblem.hpp>
+#include <BelosPseudoBlockGmresSolMgr.hpp>
+#include <BelosTpetraAdapter.hpp>
+
+#ifdef ALBANY_IFPACK2
+#include <Ifpack2_Factory.hpp>
+#endif
+
+
+namespace {
+
+// Stratimikos list of the NOX Newton direction of an application's Piro list, or NULL
+const Teuchos::ParameterList* getStratimikosList(const Teuchos::ParameterList& appParams)
+{
+  const char* path[] = { "Piro", "NOX", "Direction", "Newton", "Stratimikos Linear Solver", "Stratimikos" };
+  const Teuchos::ParameterList* pl = &appParams;
+  for(int i=0; i<6; i++) {
+    if(!pl->isSublist(path[i])) return NULL;
+    pl = &(pl->sublist(path[i]));
+  }
+  return pl;
+}
+
+// Copy parameter from (if set) into to, as name
+template<typename T>
+void copyParam(const Teuchos::ParameterList& from, const std::string& fromName,
+	       Teuchos::ParameterList& to, const std::string& name)
+{
+  if(from.isType<T>(fromName)) to.set<T>(name, from.get<T>(fromName));
+}
+
+}
+
+
+QCAD::CoulombBatchSolver::
+CoulombBatchSolver(const Teuchos::RCP<Albany::Application>& app_, int batchSize_) :
+  app(app_), batchSize(batchSize_), precType("RILUK")
+{
+  TEUCHOS_TEST_FOR_EXCEPTION( batchSize < 1, Teuchos::Exceptions::InvalidParameter,
+			      "Coulomb batch size must be positive but is " << batchSize);
+
+  // Defaults, used where the Poisson linear solver does not say otherwise
+  solverParams = Teuchos::rcp(new Teuchos::ParameterList("Coulomb Batch Linear Solver"));
+  solverParams->set<double>("Convergence Tolerance", 1e-10);
+  solverParams->set<int>("Maximum Iterations", 1000);
+  solverParams->set<int>("Num Blocks", 50);
+  solverParams->set<int>("Verbosity", 0);
+
+  const Teuchos::ParameterList* stratList = getStratimikosList(*(app->getAppPL()));
+  if(stratList != NULL) setLinearSolverParams(*stratList);
+
+  // The Coulomb sub-problem uses a single (old style) parameter list, whose last two
+  //  entries are the source eigenvector indices (see QCAD::Solver::createPoissonInputFile)
+  const Teuchos::ParameterList& paramList = app->getProblemPL()->sublist("Parameters");
+  int nParams = paramList.get<int>("Number", 0);
+  TEUCHOS_TEST_FOR_EXCEPTION( nParams < 2, Teuchos::Exceptions::InvalidParameter,
+			      "Coulomb batch solver requires the source eigenvector parameters.");
+
+  Teuchos::Array<std::string> paramNames(nParams);
+  for(int i=0; i<nParams; i++)
+    paramNames[i] = paramList.get<std::string>(Albany::strint("Parameter",i));
+
+  sacado_param_vec.resize(1);
+  app->getParamLib()->fillVector<PHAL::AlbanyTraits::Residual>(paramNames, sacado_param_vec[0]);
+}
+
+
+void QCAD::CoulombBatchSolver::setLinearSolverParams(const Teuchos::ParameterList& stratList)
+{
+  const std::string solverType = stratList.isType<std::string>("Linear Solver Type") ?
+    stratList.get<std::string>("Linear Solver Type") : "";
+  const Teuchos::ParameterList* solverTypes = stratList.isSublist("Linear Solver Types") ?
+    &stratList.sublist("Linear Solver Types") : NULL;
+
+  if(solverTypes != NULL && solverType == "Belos" && solverTypes->isSublist("Belos")) {
+    const Teuchos::ParameterList& belosList = solverTypes->sublist("Belos");
+    const std::string belosType = belosList.isType<std::string>("Solver Type") ?
+      belosList.get<std::string>("Solver Type") : "Block GMRES";
+    if(belosList.isSublist("Solver Types") && belosList.sublist("Solver Types").isSublist(belosType)) {
+      const Teuchos::ParameterList& typeList = belosList.sublist("Solver Types").sublist(belosType);
+      copyParam<double>(typeList, "Convergence Tolerance", *solverParams, "Convergence Tolerance");
+      copyParam<int>(typeList, "Maximum Iterations", *solverParams, "Maximum Iterations");
+      copyParam<int>(typeList, "Num Blocks", *solverParams, "Num Blocks");
+    }
+  }
+  else if(solverTypes != NULL && solverType == "AztecOO" && solverTypes->isSublist("AztecOO")) {
+    const Teuchos::ParameterList& aztecList = solverTypes->sublist("AztecOO");
+    if(aztecList.isSublist("Forward Solve")) {
+      const Teuchos::ParameterList& fwdList = aztecList.sublist("Forward Solve");
+      copyParam<double>(fwdList, "Tolerance", *solverParams, "Convergence Tolerance");
+      copyParam<int>(fwdList, "Max Iterations", *solverParams, "Maximum Iterations");
+      if(fwdList.isSublist("AztecOO Settings"))
+	copyParam<int>(fwdList.sublist("AztecOO Settings"), "Size of Krylov Subspace", *solverParams, "Num Blocks");
+    }
+  }
+
+  // Preconditioner: Ifpack2 types are used as they are, Ifpack ILU maps onto Ifpack2 RILUK
+  //  with the same level of fill, and anything else (e.g. ML or MueLu) falls back to ILU(0)
+  const std::string stratPrecType = stratList.isType<std::string>("Preconditioner Type") ?
+    stratList.get<std::string>("Preconditioner Type") : "";
+  const Teuchos::ParameterList* precTypes = stratList.isSublist("Preconditioner Types") ?
+    &stratList.sublist("Preconditioner Types") : NULL;
+
+  if(stratPrecType == "None") {
+    precType = "None";
+  }
+  else if(stratPrecType == "Ifpack2" && precTypes != NULL && precTypes->isSublist("Ifpack2")) {
+    const Teuchos::ParameterList& ifpack2List = precTypes->sublist("Ifpack2");
+    if(ifpack2List.isType<std::string>("Prec Type")) precType = ifpack2List.get<std::string>("Prec Type");
+    if(ifpack2List.isSublist("Ifpack2 Settings")) precParams = ifpack2List.sublist("Ifpack2 Settings");
+  }
+  else if(stratPrecType == "Ifpack" && precTypes != NULL && precTypes->isSublist("Ifpack")) {
+    const Teuchos::ParameterList& ifpackList = precTypes->sublist("Ifpack");
+    if(ifpackList.isSublist("Ifpack Settings"))
+      copyParam<int>(ifpackList.sublist("Ifpack Settings"), "fact: level-of-fill", precParams, "fact: iluk level-of-fill");
+  }
+  else {
+    Teuchos::RCP<Teuchos::FancyOStream> out(Teuchos::VerboseObjectBase::getDefaultOStream());
+    *out << "QCAD Coulomb batch: preconditioner type \"" << stratPrecType
+	 << "\" is not supported, using Ifpack2 RILUK" << std::endl;
+  }
+}
+
+
+void QCAD::CoulombBatchSolver::
+solve(const Teuchos::RCP<Albany::EigendataStruct>& eigenData,
+      const Teuchos::ArrayView<const double>& paramValues,
+      const std::vector< std::pair<int,int> >& pairs,
+      std::vector< Teuchos::RCP<Tpetra_Vector> >& responses,
+      bool bVerbose)
+{
+  typedef Tpetra_MultiVector MV;
+  typedef Tpetra_Operator Op;
+
+  ParamVec& pvec = sacado_param_vec[0];
+  const int nParams = pvec.size();
+  const int nPairs = pairs.size();
+
+  TEUCHOS_TEST_FOR_EXCEPTION( paramValues.size() != nParams, Teuchos::Exceptions::InvalidParameter,
+			      "Expected " << nParams << " Coulomb parameter values but was given " << paramValues.size());
+
+  responses.resize(nPairs);
+  if(nPairs == 0) return;
+
+  app->getStateMgr().setEigenData(eigenData);
+  for(int i=0; i<nParams; i++)
+    pvec[i].baseValue = paramValues[i];
+
+  Teuchos::RCP<const Tpetra_Map> mapT = app->getMapT();
+  Teuchos::RCP<const Tpetra_Map> gMapT = app->getResponse(0)->responseMapT();
+  Tpetra_Vector zeroT(mapT, true);
+  Tpetra_Vector fT(mapT, false);
+
+  // The residual at zero potential is -rhs for each pair (the problem is linear), so the
+  //  Jacobian only needs to be computed once, together with the first residual
+  Teuchos::RCP<Tpetra_CrsMatrix> jacT = Teuchos::rcp(new Tpetra_CrsMatrix(app->getJacobianGraphT()));
+  setPair(pairs[0].first, pairs[0].second);
+  app->computeGlobalJacobianT(0.0, 1.0, 0.0, 0.0, NULL, NULL, zeroT, sacado_param_vec, &fT, *jacT);
+
+  Teuchos::RCP<Op> prec;
+#ifdef ALBANY_IFPACK2
+  if(precType != "None") {
+    Ifpack2::Factory factory;
+    Teuchos::RCP<Ifpack2::Preconditioner<ST,LO,GO,KokkosNode> > ifpack2Prec =
+      factory.create<Tpetra_RowMatrix>(precType, jacT);
+    ifpack2Prec->setParameters(precParams);
+    ifpack2Prec->initialize();
+    ifpack2Prec->compute();
+    prec = ifpack2Prec;
+  }
+#endif
+
+  // Solve at most batchSize pairs together, which bounds the Krylov storage to
+  //  batchSize * (Num Blocks + 1) vectors
+  int nIters = 0;
+  for(int first=0; first<nPairs; first+=batchSize) {
+    const int nBatch = std::min(batchSize, nPairs - first);
+
+    Teuchos::RCP<MV> rhsT = Teuchos::rcp(new MV(mapT, nBatch, false));
+    for(int k=0; k<nBatch; k++) {
+      if(first + k > 0) {
+	setPair(pairs[first+k].first, pairs[first+k].second);
+	app->computeGlobalResidualT(0.0, NULL, NULL, zeroT, sacado_param_vec, fT);
+      }
+      rhsT->getVectorNonConst(k)->update(-1.0, fT, 0.0);
+    }
+
+    Teuchos::RCP<MV> solnT = Teuchos::rcp(new MV(mapT, nBatch, true));
+    Teuchos::RCP<Belos::LinearProblem<ST,MV,Op> > problem =
+      Teuchos::rcp(new Belos::LinearProblem<ST,MV,Op>(jacT, solnT, rhsT));
+    if(prec != Teuchos::null) problem->setRightPrec(prec);
+    problem->setProblem();
+
+    Teuchos::RCP<Teuchos::ParameterList> belosParams = Teuchos::rcp(new Teuchos::ParameterList(*solverParams));
+    Belos::PseudoBlockGmresSolMgr<ST,MV,Op> belosSolver(problem, belosParams);
+    Belos::ReturnType ret = belosSolver.solve();
+    TEUCHOS_TEST_FOR_EXCEPTION( ret != Belos::Converged, std::runtime_error,
+				"Coulomb batch linear solve did not converge in "
+				<< belosSolver.getNumIters() << " iterations");
+    nIters += belosSolver.getNumIters();
+
+    // Responses at each solution
+    for(int k=0; k<nBatch; k++) {
+      setPair(pairs[first+k].first, pairs[first+k].second);
+      responses[first+k] = Teuchos::rcp(new Tpetra_Vector(gMapT, true));
+      app->evaluateResponseT(0, 0.0, NULL, NULL, *(solnT->getVector(k)), sacado_param_vec, *(responses[first+k]));
+    }
+  }
+
+  if(bVerbose) {
+    Teuchos::RCP<Teuchos::FancyOStream> out(Teuchos::VerboseObjectBase::getDefaultOStream());
+    *out << "QCAD Coulomb batch: solved " << nPairs << " Poisson problems in batches of "
+	 << batchSize << ", " << nIters << " linear iterations" << std::endl;
+  }
+}
+
+
+void QCAD::CoulombBatchSolver::setPair(int i2, int i4)
+{
+  // the last two parameters are i2 and i4 -- indices for the coulomb element to be computed
+  ParamVec& pvec = sacado_param_vec[0];
+  std::size_t nParams = pvec.size();
+  pvec[ nParams-2 ].baseValue = (double) i2;
+  pvec[ nParams-1 ].baseValue = (double) i4;
+}
@@ -0,0 +1,74 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef QCAD_COULOMBBATCHSOLVER_H
+#define QCAD_COULOMBBATCHSOLVER_H
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_ArrayView.hpp"
+#include "Teuchos_ParameterList.hpp"
+
+#include "Albany_DataTypes.hpp"
+#include "Albany_Application.hpp"
+#include "Albany_EigendataInfoStruct.hpp"
+
+namespace QCAD {
+
+/**
+ *  \brief Solves the Coulomb Poisson sub-problem for many source eigenvector pairs at once
+ *
+ *  The Coulomb Poisson problem (see "Coulomb" special processing in QCAD::Solver) is linear
+ *  in the potential and only its source depends on the (i2,i4) pair, which is selected by the
+ *  last two parameters ("Source Eigenvector 1" and "Source Eigenvector 2").  Instead of running a
+ *  full nonlinear solve per pair, the Jacobian is assembled and preconditioned once, the residual
+ *  at zero potential gives one right-hand side per pair, and the pairs are solved together, at
+ *  most batchSize at a time, as the columns of a multivector.  Response 0 of the application is
+ *  then evaluated for each pair.
+ *
+ *  The tolerance, iteration limit, Krylov subspace size and preconditioner are taken from the
+ *  Stratimikos list of the application's Piro NOX Newton direction, i.e. from the linear solver
+ *  the user set up for the Poisson solve.
+ */
+
+  class CoulombBatchSolver {
+  public:
+    CoulombBatchSolver(const Teuchos::RCP<Albany::Application>& app, int batchSize);
+
+    //! Solve for all pairs and return response 0 for each (in the order of pairs)
+    //   paramValues are the current values of the application's parameter vector; the last
+    //   two are replaced by the pair indices.
+    void solve(const Teuchos::RCP<Albany::EigendataStruct>& eigenData,
+	       const Teuchos::ArrayView<const double>& paramValues,
+	       const std::vector< std::pair<int,int> >& pairs,
+	       std::vector< Teuchos::RCP<Tpetra_Vector> >& responses,
+	       bool bVerbose);
+
+  private:
+    void setPair(int i2, int i4);
+
+    //! Read the linear solver and preconditioner settings from the Stratimikos list
+    void setLinearSolverParams(const Teuchos::ParameterList& stratList);
+
+    Teuchos::RCP<Albany::Application> app;
+    int batchSize;
+
+    //! Belos parameters
+    Teuchos::RCP<Teuchos::ParameterList> solverParams;
+
+    //! Ifpack2 preconditioner type ("None" for no preconditioner) and parameters
+    std::string precType;
+    Teuchos::ParameterList precParams;
+
+    Teuchos::Array<ParamVec> sacado_param_vec;
+  };
+
+}
+
+#endif
@@ -6,6 +6,7 @@
 
 #include "QCAD_Solver.hpp"
 #include "QCAD_CoupledPoissonSchrodinger.hpp"
+#include "QCAD_CoulombBatchSolver.hpp"
 #include "Piro_Epetra_LOCASolver.hpp"
 
 #include "Petra_Converters.hpp"
@@ -165,6 +166,11 @@ Solver(const Teuchos::RCP<Teuchos::ParameterList>& appParams,
     bUseTotalSpinSymmetry = problemParams.get<bool>("Use S2 Symmetry in CI", false);
   }
 
+  // Batched Coulomb solves, used to fill the CI 2P-matrix in both CI modes
+  coulombBatchSize = 0;
+  if(problemParams.get<bool>("Use Batched Coulomb Solves", false))
+    coulombBatchSize = problemParams.get<int>("Coulomb Batch Size", 16);
+
   // Get problem parameters used for Schrodinger-CI mode
   if(problemNameBase == "Schrodinger CI") {
     nCIParticles = problemParams.get<int>("CI Particles");
@@ -1497,11 +1503,11 @@ QCAD::Solver::evalCIModel(const InArgs& inArgs,
   ciSolver.fill1Pmx(eigenDataToPass);
   if(!bRealEvecs) {
     ciSolver.fill2Pmx(eigenDataToPass, &subSolvers["CoulombPoisson"], 
-		      &subSolvers["CoulombPoissonIm"], rcp_nullvec, bRealEvecs, bVerbose);
+		      &subSolvers["CoulombPoissonIm"], rcp_nullvec, bRealEvecs, bVerbose, coulombBatchSize);
   }
   else {
     ciSolver.fill2Pmx(eigenDataToPass, &subSolvers["CoulombPoisson"],
-		      NULL, rcp_nullvec, bRealEvecs, bVerbose);
+		      NULL, rcp_nullvec, bRealEvecs, bVerbose, coulombBatchSize);
   }
           
   //Now should have H1P and H2P - run CI:
@@ -1657,12 +1663,12 @@ QCAD::Solver::evalPoissonCIModel(const InArgs& inArgs,
 	  subSolvers[ "CoulombPoissonIm" ] = CreateSubSolver( "CoulombPoissonIm", getSubSolverParams("CoulombPoissonIm") , *solverComm);
 	  fillSingleSubSolverParams(inArgs, "Poisson", subSolvers[ "CoulombPoissonIm" ]);
 	  ciSolver.fill2Pmx(eigenDataToPass, &subSolvers["CoulombPoisson"], &subSolvers["CoulombPoissonIm"], 
-			    g_noCharge, bRealEvecs, bVerbose); 
+			    g_noCharge, bRealEvecs, bVerbose, coulombBatchSize); 
 	  subSolvers[ "CoulombPoissonIm" ].freeUp();
 	}
 	else {
 	  ciSolver.fill2Pmx(eigenDataToPass, &subSolvers["CoulombPoisson"], NULL, 
-			    g_noCharge, bRealEvecs, bVerbose); 
+			    g_noCharge, bRealEvecs, bVerbose, coulombBatchSize); 
 	}
 	subSolvers[ "CoulombPoisson" ].freeUp();
 
@@ -2366,6 +2372,8 @@ QCAD::Solver::getValidProblemParameters() const
   validPL->set<int>("CI Particles", 0, "Schrodinger CI mode only: the number of particles to use in the CI phase");
   validPL->set<int>("CI Excitations", 0, "Schrodinger CI mode only: the number of excitations with which to truncate the CI phase");
   validPL->set<bool>("Use S2 Symmetry in CI",false,"Use total spin symmetry in the CI part of a problem");
+  validPL->set<bool>("Use Batched Coulomb Solves",false,"Assemble the Coulomb Poisson operator once and solve for the eigenvector pairs together when filling the CI 2P-matrix, using the Poisson linear solver settings");
+  validPL->set<int>("Coulomb Batch Size",16,"Number of eigenvector pairs solved together by each linear solve when using batched Coulomb solves");
 
   validPL->set<bool>("Include exchange-correlation potential",false,"Include exchange-correlation potential in poisson source term");
   validPL->set<bool>("Only solve schrodinger in quantum blocks",true,"Limit schrodinger solution to elements blocks labeled as quantum in the materials DB");
@@ -3080,32 +3088,57 @@ void QCAD::CISolver::fill2Pmx(Teuchos::RCP<Albany::EigendataStruct> eigenData1P,
 			      const SolverSubSolver* coulombSolver, 
 			      const SolverSubSolver* coulombSolver_ImPart,
 			      const Teuchos::RCP<Epetra_Vector>& g_noCharge,
-			      bool bRealEvecs, bool bVerbose)
+			      bool bRealEvecs, bool bVerbose, int batchSize)
 {
   Teuchos::RCP<Albany::EigendataStruct> eigenDataNull = Teuchos::null; // dummy
   Teuchos::RCP<Epetra_Vector> g_reSrc, g_imSrc;
 
+  // In batched mode, solve the Coulomb Poisson problems for all (i2,i4) pairs up front
+  const bool bBatched = (batchSize > 0);
+  std::vector<Teuchos::RCP<Epetra_Vector> > g_reSrcBatch, g_imSrcBatch;
+  if(bBatched) {
+    std::vector< std::pair<int,int> > pairs;
+    for(int i2=0; i2<n1PperBlock; i2++)
+      for(int i4=i2; i4<n1PperBlock; i4++) pairs.push_back( std::make_pair(i2,i4) );
+
+    if(bVerbose) *out << "QCAD Solve: Coulomb Poisson batch of " << pairs.size() << " pairs" << std::endl;
+    BatchSolveCoulomb(eigenData1P, coulombSolver, pairs, batchSize, bVerbose, g_reSrcBatch);
+
+    if(!bRealEvecs) {
+      if(bVerbose) *out << "QCAD Solve: Imaginary Coulomb Poisson batch of " << pairs.size() << " pairs" << std::endl;
+      BatchSolveCoulomb(eigenData1P, coulombSolver_ImPart, pairs, batchSize, bVerbose, g_imSrcBatch);
+    }
+  }
+
   // fill in mx2P (4 blocks, each n1PperBlock x n1PperBlock x n1PperBlock x n1PperBlock )
+  int iPair = 0;
   for(int i2=0; i2<n1PperBlock; i2++) {
-    for(int i4=i2; i4<n1PperBlock; i4++) {
+    for(int i4=i2; i4<n1PperBlock; i4++, iPair++) {
       
-      // Coulomb Poisson Solve - get coulomb els in reponse vector
-      if(bVerbose) *out << "QCAD Solve: Coulomb " << i2 << "," << i4 << " Poisson" << std::endl;
-      SetCoulombParams( coulombSolver->params_in, i2,i4 ); 
-      QCAD::SolveModel(*coulombSolver, eigenData1P, eigenDataNull);
-      g_reSrc = coulombSolver->responses_out->get_g(0); //only use *first* response vector    
+      if(bBatched) {
+	g_reSrc = g_reSrcBatch[iPair];
+	if(!bRealEvecs) g_imSrc = g_imSrcBatch[iPair];
+      }
+      else {
+	// Coulomb Poisson Solve - get coulomb els in reponse vector
+	if(bVerbose) *out << "QCAD Solve: Coulomb " << i2 << "," << i4 << " Poisson" << std::endl;
+	SetCoulombParams( coulombSolver->params_in, i2,i4 ); 
+	QCAD::SolveModel(*coulombSolver, eigenData1P, eigenDataNull);
+	g_reSrc = coulombSolver->responses_out->get_g(0); //only use *first* response vector    
+
+	if(!bRealEvecs) {
+	  // Coulomb Poisson Solve - get imaginary coulomb els in reponse vector
+	  if(bVerbose) *out << "QCAD Solve: Imaginary Coulomb " << i2 << "," << i4 << " Poisson" << std::endl;
+	  SetCoulombParams( coulombSolver_ImPart->params_in, i2,i4 ); 
+	  QCAD::SolveModel(*coulombSolver_ImPart, eigenData1P, eigenDataNull);
+	  g_imSrc = coulombSolver_ImPart->responses_out->get_g(0); //only use *first* response vector    
+	}
+      }
 
       *out << "DEBUG: g_reSrc vector:" << std::endl; //DEBUG
       for(int i=0; i< g_reSrc->MyLength(); i++) *out << "  g_reSrc[" << i << "] = " << (*g_reSrc)[i] << std::endl;	      
-	      
 
       if(!bRealEvecs) {
-	// Coulomb Poisson Solve - get imaginary coulomb els in reponse vector
-	if(bVerbose) *out << "QCAD Solve: Imaginary Coulomb " << i2 << "," << i4 << " Poisson" << std::endl;
-	SetCoulombParams( coulombSolver_ImPart->params_in, i2,i4 ); 
-	QCAD::SolveModel(*coulombSolver_ImPart, eigenData1P, eigenDataNull);
-	g_imSrc = coulombSolver_ImPart->responses_out->get_g(0); //only use *first* response vector    
-	      
 	*out << "DEBUG: g_imSrc vector:" << std::endl; //DEBUG
 	for(int i=0; i< g_imSrc->MyLength(); i++) *out << "  g_imSrc[" << i << "] = " << (*g_imSrc)[i] << std::endl;
       }
@@ -3269,6 +3302,33 @@ QCAD::CISolver::ComputeStateDensities(Teuchos::RCP<Albany::EigendataStruct> eige
 }
 
 
+void QCAD::CISolver::BatchSolveCoulomb(const Teuchos::RCP<Albany::EigendataStruct>& eigenData1P,
+				       const SolverSubSolver* coulombSolver,
+				       const std::vector< std::pair<int,int> >& pairs,
+				       int batchSize, bool bVerbose,
+				       std::vector<Teuchos::RCP<Epetra_Vector> >& g_batch) const
+{
+  TEUCHOS_TEST_FOR_EXCEPTION( coulombSolver->params_in->Np() < 1, Teuchos::Exceptions::InvalidParameter, 
+			      "Cannot set coulomb parameters because there are no parameter vectors.");
+  const Epetra_Vector& p = *(coulombSolver->params_in->get_p(0)); //only use *first* param vector now
+  Teuchos::Array<double> paramValues(p.MyLength());
+  for(int i=0; i<p.MyLength(); i++) paramValues[i] = p[i];
+
+  QCAD::CoulombBatchSolver batchSolver(coulombSolver->app, batchSize);
+  std::vector<Teuchos::RCP<Tpetra_Vector> > g_batchT;
+  batchSolver.solve(eigenData1P, paramValues(), pairs, g_batchT, bVerbose);
+
+  // convert to Epetra vectors laid out like the sub-solver's *first* response vector
+  const Epetra_BlockMap& g_map = coulombSolver->responses_out->get_g(0)->Map();
+  Teuchos::RCP<const Epetra_Comm> commE = coulombSolver->app->getEpetraComm();
+  g_batch.resize(g_batchT.size());
+  for(std::size_t k=0; k<g_batchT.size(); k++) {
+    g_batch[k] = Teuchos::rcp(new Epetra_Vector(g_map));
+    Petra::TpetraVector_To_EpetraVector(g_batchT[k], *(g_batch[k]), commE);
+  }
+}
+
+
 void QCAD::CISolver::SetCoulombParams(const Teuchos::RCP<EpetraExt::ModelEvaluator::InArgs> inArgs, int i2, int i4) const
 {
   TEUCHOS_TEST_FOR_EXCEPTION( inArgs->Np() < 1, Teuchos::Exceptions::InvalidParameter, 
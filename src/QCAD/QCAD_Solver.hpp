@@ -173,6 +173,7 @@ namespace QCAD {
     double fixedPSOcc;
     bool   bUseIntegratedPS;
     bool   bUseTotalSpinSymmetry; // use S2 symmetry in CI calculation
+    int    coulombBatchSize;      // Coulomb Poisson problems of the CI 2P-matrix solved together (0 = one at a time)
   };
 
 
@@ -267,7 +268,7 @@ namespace QCAD {
 		  const SolverSubSolver* coulombSolver,
 		  const SolverSubSolver* coulombSolver_ImPart,
 		  const Teuchos::RCP<Epetra_Vector>& g_noCharge,
-		  bool bRealEvecs, bool bVerbose);
+		  bool bRealEvecs, bool bVerbose, int batchSize = 0);
 
     Teuchos::RCP<AlbanyCI::Solution> Solve(Teuchos::RCP<Teuchos::ParameterList> AlbanyCIList) const;
 
@@ -277,6 +278,11 @@ namespace QCAD {
 
   private:
     void SetCoulombParams(const Teuchos::RCP<EpetraExt::ModelEvaluator::InArgs> inArgs, int i2, int i4) const;
+    void BatchSolveCoulomb(const Teuchos::RCP<Albany::EigendataStruct>& eigenData1P,
+			   const SolverSubSolver* coulombSolver,
+			   const std::vector< std::pair<int,int> >& pairs,
+			   int batchSize, bool bVerbose,
+			   std::vector<Teuchos::RCP<Epetra_Vector> >& g_batch) const;
 
   private:
     // number of single particle states of each type of spin (up / down)
@@ -229,6 +229,9 @@ namespace QCAD {
     struct PointCharge { MeshScalarT position[3]; ScalarT position_param[3]; ScalarT charge; int iWorkset, iCell; };
     std::vector< PointCharge > pointCharges;
     std::size_t numWorksetsScannedForPtCharges;
+
+    //! Slot of this evaluator in the workset scratch peak usage
+    int scratchUser;
     
     //! Cloud Charge parameters
     struct CloudCharge { ScalarT position[3]; ScalarT amplitude, width, cutoff;};
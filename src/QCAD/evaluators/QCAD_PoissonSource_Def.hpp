@@ -347,6 +347,7 @@ postRegistrationSetup(typename Traits::SetupData d,
   for(it = meshRegionList.begin(); it != meshRegionList.end(); it++)
     (*it)->postRegistrationSetup(fm);
 
+  scratchUser = PHAL::WorksetScratch::registerUser(this->getName());
 }
 
 // **********************************************************************
@@ -1568,10 +1569,14 @@ QCAD::PoissonSource<EvalT,Traits>::eDensityForPoissonSchrodinger
   ScalarT kbT = kbBoltz*temperature / energy_unit_in_eV;  // in [myV]
   ScalarT eDensity = 0.0; 
 
+  // Temporaries for each (cell, qp) come from the workset scratch arena
+  PHAL::ScratchScope scratch(workset.scratch, scratchUser);
+
   // assume eigenvalues are in [myV] units (units of energy_unit_in_eV * eV)
   const std::vector<double>& neg_eigenvals = *(workset.eigenDataPtr->eigenvalueRe); 
-  std::vector<double> eigenvals( neg_eigenvals );
-  for(unsigned int i=0; i<eigenvals.size(); ++i) eigenvals[i] *= -1; //apply minus sign (b/c of eigenval convention)
+  const std::size_t nEigenvals = neg_eigenvals.size();
+  double* eigenvals = scratch.allocate<double>(nEigenvals);
+  for(unsigned int i=0; i<nEigenvals; ++i) eigenvals[i] = -neg_eigenvals[i]; //apply minus sign (b/c of eigenval convention)
 
 
   // determine deltaPhi used in computing quantum electron density
@@ -1585,7 +1590,7 @@ QCAD::PoissonSource<EvalT,Traits>::eDensityForPoissonSchrodinger
     deltaPhi = 0.0;  // false: do not apply the p-c method
 
   ScalarT eDenPrefactor;
-  std::vector<ScalarT> occ( eigenvals.size(), 0.0); //occupation of ith eigenstate
+  ScalarT* occ = scratch.allocate<ScalarT>(nEigenvals); //occupation of ith eigenstate
   
   // compute quantum "occupation" according to dimensionality, which is just the coefficient 
   //   of each (wavefunction)^2 term in the density, as well as a prefactor.
@@ -1739,8 +1744,8 @@ QCAD::PoissonSource<EvalT,Traits>::eDensityForPoissonCI
   ScalarT eDensity = 0.0; 
   //double Ef = 0.0;  //Fermi energy == 0
 
-  const std::vector<double>& neg_eigenvals = *(workset.eigenDataPtr->eigenvalueRe);
-  std::vector<double> eigenvals( neg_eigenvals );
+  // CI eigenvalues are used as they are, so they are read in place
+  const std::vector<double>& eigenvals = *(workset.eigenDataPtr->eigenvalueRe);
   int nCIEvals = eigenvals.size(); //not necessarily == nEigenvectors, since CI could have not converged as many as requested
   int nEvals = std::min(nCIEvals, nEigenvectors); // the number of eigen-pairs to use (we don't gather more than nEigenvectors)
 
@@ -1750,7 +1755,8 @@ QCAD::PoissonSource<EvalT,Traits>::eDensityForPoissonCI
   //Note: NO predictor corrector method used here yet -- need to understand what's going on better first
 
   ScalarT eDenPrefactor;
-  std::vector<ScalarT> occ( nEvals, 0.0); //occupation of ith eigenstate
+  PHAL::ScratchScope scratch(workset.scratch, scratchUser);
+  ScalarT* occ = scratch.allocate<ScalarT>(nEvals); //occupation of ith eigenstate
   
   // compute quantum electron density according to dimensionality
   switch (numDims)
@@ -1888,7 +1894,8 @@ void QCAD::PoissonSource<EvalT,Traits>::source_pointcharges(typename Traits::Eva
     
     //std::cout << "DEBUG: Looking for point charges in ws " << workset.wsIndex << " - scanned " 
     //	<< numWorksetsScannedForPtCharges << " worksets so far" << std::endl;
-    MeshScalarT* cellVertices = new MeshScalarT[numNodes*numDims];
+    PHAL::ScratchScope scratch(workset.scratch, scratchUser);
+    MeshScalarT* cellVertices = scratch.allocate<MeshScalarT>(numNodes*numDims);
     for (std::size_t cell=0; cell < workset.numCells; ++cell) {
 	for( std::size_t node=0; node<numNodes; ++node ) {
 	  for( std::size_t k=0; k<numDims; ++k )
@@ -1910,7 +1917,6 @@ void QCAD::PoissonSource<EvalT,Traits>::source_pointcharges(typename Traits::Eva
 	  }
 	}
     }
-    delete [] cellVertices;
 
     assert(workset.wsIndex == numWorksetsScannedForPtCharges); //equality should always hold in if stmt above
     numWorksetsScannedForPtCharges++;
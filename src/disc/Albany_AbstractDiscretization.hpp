@@ -121,6 +121,17 @@ class AbstractDiscretization {
     //! Get map from (Ws, El, Local Node, Eq) -> unkLID
     virtual const Conn& getWsElNodeEqID() const = 0;
 
+    using WorksetJacOffsets = Kokkos::View<LO***, Kokkos::LayoutRight, PHX::Device>;
+    using JacOffsets = typename Albany::WorksetArray<WorksetJacOffsets>::type;
+
+    //! Get map from (Ws, El, Local Unk Row, Local Unk Col) -> offset into the
+    //! values of the overlapped Jacobian (-1 if the entry is not in the graph).
+    //! Empty if the discretization does not precompute it.
+    virtual const JacOffsets& getWsJacobianOffsets() const {
+      static const JacOffsets empty;
+      return empty;
+    }
+
     //! Get map from (Ws, El, Local Node) -> unkGID
     virtual const WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> > >::type&
       getWsElNodeID() const = 0;
@@ -137,6 +148,24 @@ class AbstractDiscretization {
     //! Retrieve coodinate ptr_field (ws, el, node)
     virtual const WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*> > >::type& getCoords() const = 0;
 
+    using WorksetCoords = Kokkos::View<double***, Kokkos::LayoutLeft, PHX::Device>;
+    using PackedCoords = typename Albany::WorksetArray<WorksetCoords>::type;
+
+    //! Get packed coordinates (ws)(el, node, dim), contiguous along elements.
+    //! Empty if the discretization does not pack them.
+    virtual const PackedCoords& getPackedCoords() const {
+      static const PackedCoords empty;
+      return empty;
+    }
+
+    //! Counter that changes whenever the mesh topology or node coordinates
+    //! change; negative if the discretization does not keep track of it.
+    virtual int getMeshVersion() const { return -1; }
+
+    //! Tell the discretization that the node coordinates were moved in place
+    //! (e.g. by a mesh mover), so that it refreshes what it derived from them.
+    virtual void coordinatesChanged() {}
+
     //! Get coordinates (overlap map).
     virtual const Teuchos::ArrayRCP<double>& getCoordinates() const = 0;
     //! Set coordinates (overlap map) for mesh adaptation.
@@ -62,6 +62,10 @@ namespace Albany {
     bool exoOutput;
     std::string exoOutFile;
     int exoOutputInterval;
+    //! Write Exodus output from a background thread
+    bool exoOutputAsync = false;
+    //! Pairs (output field, staging copy) used by the asynchronous Exodus output
+    std::vector<std::pair<stk::mesh::FieldBase*,stk::mesh::FieldBase*> > asyncOutputFields;
     std::string cdfOutFile;
     bool cdfOutput;
     unsigned nLat;
@@ -39,6 +39,25 @@
 #include <stk_adapt/UniformRefinerPattern.hpp>
 #endif
 
+// The background Exodus writer calls Ioss, which may call MPI while the
+// solver thread does too. That needs MPI_THREAD_MULTIPLE (see
+// Albany::initializeMPIThreads). The writer uses its own duplicate of the
+// communicator, so its collectives cannot be matched with the solver's.
+static bool
+asyncExodusOutputSupported()
+{
+#ifdef ALBANY_MPI
+  int initialized = 0;
+  MPI_Initialized(&initialized);
+  if (initialized) {
+    int provided = MPI_THREAD_SINGLE;
+    MPI_Query_thread(&provided);
+    return provided == MPI_THREAD_MULTIPLE;
+  }
+#endif
+  return true;
+}
+
 static void
 printCTD(const CellTopologyData & t )
 {
@@ -196,6 +215,14 @@ void Albany::GenericSTKMeshStruct::SetupFieldData(
   if (exoOutput)
     exoOutFile = params->get<std::string>("Exodus Output File Name");
   exoOutputInterval = params->get<int>("Exodus Write Interval", 1);
+  exoOutputAsync = exoOutput && params->get<bool>("Asynchronous Exodus Output", false);
+  if (exoOutputAsync && !asyncExodusOutputSupported()) {
+    Teuchos::RCP<Teuchos::FancyOStream> out =
+      Teuchos::VerboseObjectBase::getDefaultOStream();
+    *out << "Warning: Asynchronous Exodus Output needs MPI_THREAD_MULTIPLE; "
+            "writing Exodus output synchronously" << std::endl;
+    exoOutputAsync = false;
+  }
   cdfOutput = params->isType<std::string>("NetCDF Output File Name");
   if (cdfOutput)
     cdfOutFile = params->get<std::string>("NetCDF Output File Name");
@@ -223,6 +250,9 @@ void Albany::GenericSTKMeshStruct::SetupFieldData(
 
   transferSolutionToCoords = params->get<bool>("Transfer Solution to Coordinates", false);
 
+  if (exoOutputAsync)
+    declareAsyncOutputFields();
+
 #ifdef ALBANY_STK_PERCEPT
   // Build the eMesh if needed
   if(buildEMesh)
@@ -265,6 +295,32 @@ void Albany::GenericSTKMeshStruct::setAllPartsIO()
   }
 }
 
+void Albany::GenericSTKMeshStruct::declareAsyncOutputFields()
+{
+#ifdef ALBANY_SEACAS
+  // The background writer reads these copies, so the solver can keep
+  // updating the original fields while a step is being written. Fields
+  // declared after this point (e.g., side maps) are constant and are
+  // written directly.
+  const stk::mesh::FieldVector fields = metaData->get_fields();
+  for (stk::mesh::FieldBase* field : fields) {
+    if (stk::io::get_field_role(*field) == nullptr)
+      continue;
+
+    stk::mesh::FieldBase* staging = metaData->declare_field_base(
+        field->name() + "_async_output", field->entity_rank(),
+        field->data_traits(), field->field_array_rank(),
+        field->dimension_tags(), 1);
+
+    for (const stk::mesh::FieldRestriction& r : field->restrictions()) {
+      metaData->declare_field_restriction(*staging, r.selector(),
+          r.num_scalars_per_entity(), r.dimension());
+    }
+    asyncOutputFields.push_back(std::make_pair(field, staging));
+  }
+#endif
+}
+
 bool Albany::GenericSTKMeshStruct::buildPerceptEMesh(){
 
    // If there exists a nonempty "refine", "convert", or "enrich" string
@@ -1769,6 +1825,8 @@ Albany::GenericSTKMeshStruct::getValidGenericSTKParameters(std::string listname)
       "Name of solution_dotdot dtk written to Exodus file. Requires SEACAS build");
 #endif
   validPL->set<int>("Exodus Write Interval", 3, "Step interval to write solution data to Exodus file");
+  validPL->set<bool>("Asynchronous Exodus Output", false,
+                     "Write Exodus output from a background thread on a duplicate communicator; needs MPI_THREAD_MULTIPLE, which the Albany, AlbanyT and AlbanyTempus drivers request, otherwise output is synchronous");
   validPL->set<std::string>("NetCDF Output File Name", "",
       "Request NetCDF output to given file name. Requires SEACAS build");
   validPL->set<int>("NetCDF Write Interval", 1, "Step interval to write solution data to NetCDF file");
@@ -1783,6 +1841,10 @@ Albany::GenericSTKMeshStruct::getValidGenericSTKParameters(std::string listname)
   validPL->set<int>("Workset Size", DEFAULT_WORKSET_SIZE, "Upper bound on workset (bucket) size");
   validPL->set<bool>("Use Automatic Aura", false, "Use automatic aura with BulkData");
   validPL->set<bool>("Interleaved Ordering", true, "Flag for interleaved or blocked unknown ordering");
+  validPL->set<bool>("Precompute Jacobian Offsets", false,
+                     "Flag to precompute the location of element Jacobian entries in the overlapped Jacobian values");
+  validPL->set<bool>("Pack Workset Coordinates", false,
+                     "Flag to store workset coordinates in contiguous arrays, one per node and dimension");
   validPL->set<bool>("Separate Evaluators by Element Block", false,
                      "Flag for different evaluation trees for each Element Block");
   validPL->set<std::string>("Transform Type", "None", "None or ISMIP-HOM Test A"); //for FELIX problem that require tranformation of STK mesh
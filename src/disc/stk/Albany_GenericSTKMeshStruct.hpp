@@ -90,6 +90,9 @@ namespace Albany {
     //! Sets all mesh parts as IO parts (will be written to file)
     void setAllPartsIO();
 
+    //! Declares a staging copy of each output field, for asynchronous Exodus output
+    void declareAsyncOutputFields();
+
     //! Determine if a percept mesh object is needed
     bool buildEMesh;
     bool buildPerceptEMesh();
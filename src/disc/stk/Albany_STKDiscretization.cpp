@@ -5,6 +5,9 @@
 //*****************************************************************//
 
 #include <limits>
+#include <cstring>
+#include <map>
+#include <set>
 
 #include "Albany_Utils.hpp"
 #include "Albany_STKDiscretization.hpp"
@@ -13,6 +16,7 @@
 #include "Albany_BucketArray.hpp"
 
 #include <string>
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 
@@ -93,6 +97,17 @@ STKDiscretization(
 Albany::STKDiscretization::~STKDiscretization()
 {
 #ifdef ALBANY_SEACAS
+  // A failed background write must not escape the destructor
+  try {
+    waitForAsyncExodusOutput();
+  } catch (const std::exception& e) {
+    *out << "Error: asynchronous Exodus output to " << stkMeshStruct->exoOutFile
+         << " failed: " << e.what() << std::endl;
+  } catch (...) {
+    *out << "Error: asynchronous Exodus output to " << stkMeshStruct->exoOutFile
+         << " failed" << std::endl;
+  }
+
   if (stkMeshStruct->cdfOutput) {
     if (netCDFp) {
       const int ierr = nc_close (netCDFp);
@@ -783,7 +798,9 @@ writeSolutionToFileT(const Tpetra_Vector& solnT, const double time,
 
    Teuchos::RCP<AbstractSTKFieldContainer> container = stkMeshStruct->getFieldContainer();
 
+   waitForAsyncExodusOutput();
    container->transferSolutionToCoords();
+   coordinatesChanged();
 
    if (!mesh_data.is_null()) {
      // Mesh coordinates have changed. Rewrite output file by deleting the mesh data object and recreate it
@@ -796,24 +813,7 @@ writeSolutionToFileT(const Tpetra_Vector& solnT, const double time,
 
    double time_label = monotonicTimeLabel(time);
 
-     mesh_data->begin_output_step(outputFileIdx, time_label);
-     int out_step = mesh_data->write_defined_output_fields(outputFileIdx);
-     // Writing mesh global variables
-     for (auto& it : stkMeshStruct->getFieldContainer()->getMeshVectorStates())
-     {
-       mesh_data->write_global (outputFileIdx, it.first, it.second);
-     }
-     for (auto& it : stkMeshStruct->getFieldContainer()->getMeshScalarIntegerStates())
-     {
-       mesh_data->write_global (outputFileIdx, it.first, it.second);
-     }
-     mesh_data->end_output_step(outputFileIdx);
-
-     if (mapT->getComm()->getRank()==0) {
-       *out << "Albany::STKDiscretization::writeSolution: writing time " << time;
-       if (time_label != time) *out << " with label " << time_label;
-       *out << " to index " <<out_step<<" in file "<<stkMeshStruct->exoOutFile<< std::endl;
-     }
+     writeExodusOutputStep(time, time_label);
    }
    if (stkMeshStruct->cdfOutput && !(outputInterval % stkMeshStruct->cdfOutputInterval)) {
 
@@ -860,7 +860,9 @@ writeSolutionMVToFile(const Tpetra_MultiVector& solnT, const double time,
 
    Teuchos::RCP<AbstractSTKFieldContainer> container = stkMeshStruct->getFieldContainer();
 
+   waitForAsyncExodusOutput();
    container->transferSolutionToCoords();
+   coordinatesChanged();
 
    if (!mesh_data.is_null()) {
      // Mesh coordinates have changed. Rewrite output file by deleting the mesh data object and recreate it
@@ -873,24 +875,7 @@ writeSolutionMVToFile(const Tpetra_MultiVector& solnT, const double time,
 
    double time_label = monotonicTimeLabel(time);
 
-     mesh_data->begin_output_step(outputFileIdx, time_label);
-     int out_step = mesh_data->write_defined_output_fields(outputFileIdx);
-     // Writing mesh global variables
-     for (auto& it : stkMeshStruct->getFieldContainer()->getMeshVectorStates())
-     {
-       mesh_data->write_global (outputFileIdx, it.first, it.second);
-     }
-     for (auto& it : stkMeshStruct->getFieldContainer()->getMeshScalarIntegerStates())
-     {
-       mesh_data->write_global (outputFileIdx, it.first, it.second);
-     }
-     mesh_data->end_output_step(outputFileIdx);
-
-     if (mapT->getComm()->getRank()==0) {
-       *out << "Albany::STKDiscretization::writeSolution: writing time " << time;
-       if (time_label != time) *out << " with label " << time_label;
-       *out << " to index " <<out_step<<" in file "<<stkMeshStruct->exoOutFile<< std::endl;
-     }
+     writeExodusOutputStep(time, time_label);
    }
    if (stkMeshStruct->cdfOutput && !(outputInterval % stkMeshStruct->cdfOutputInterval)) {
 
@@ -928,6 +913,88 @@ writeSolutionMVToFile(const Tpetra_MultiVector& solnT, const double time,
 
 }
 
+void
+Albany::STKDiscretization::writeExodusOutputStep(const double time, const double time_label)
+{
+#ifdef ALBANY_SEACAS
+  if (!stkMeshStruct->exoOutputAsync) {
+    mesh_data->begin_output_step(outputFileIdx, time_label);
+    int out_step = mesh_data->write_defined_output_fields(outputFileIdx);
+    // Writing mesh global variables
+    for (auto& it : stkMeshStruct->getFieldContainer()->getMeshVectorStates())
+    {
+      mesh_data->write_global (outputFileIdx, it.first, it.second);
+    }
+    for (auto& it : stkMeshStruct->getFieldContainer()->getMeshScalarIntegerStates())
+    {
+      mesh_data->write_global (outputFileIdx, it.first, it.second);
+    }
+    mesh_data->end_output_step(outputFileIdx);
+
+    if (mapT->getComm()->getRank()==0) {
+      *out << "Albany::STKDiscretization::writeSolution: writing time " << time;
+      if (time_label != time) *out << " with label " << time_label;
+      *out << " to index " <<out_step<<" in file "<<stkMeshStruct->exoOutFile<< std::endl;
+    }
+    return;
+  }
+
+  // Only one step is in flight: the staging fields hold its data until the
+  // writer is done, so wait for it before taking the next snapshot
+  waitForAsyncExodusOutput();
+
+  for (auto& it : stkMeshStruct->asyncOutputFields) {
+    const stk::mesh::FieldBase& field = *it.first;
+    const stk::mesh::FieldBase& staging = *it.second;
+    const stk::mesh::BucketVector& buckets = bulkData.buckets(field.entity_rank());
+    for (stk::mesh::Bucket* bucket : buckets) {
+      const unsigned bytes = stk::mesh::field_bytes_per_entity(field, *bucket);
+      if (bytes == 0) continue;
+      std::memcpy(stk::mesh::field_data(staging, *bucket),
+                  stk::mesh::field_data(field, *bucket),
+                  bytes * bucket->size());
+    }
+  }
+
+  // Mesh global variables are copied as well
+  AbstractSTKFieldContainer::MeshVectorState vector_states =
+    stkMeshStruct->getFieldContainer()->getMeshVectorStates();
+  AbstractSTKFieldContainer::MeshScalarIntegerState integer_states =
+    stkMeshStruct->getFieldContainer()->getMeshScalarIntegerStates();
+
+  asyncExodusOutput = std::async(std::launch::async,
+    [this, time_label, vector_states, integer_states] () mutable {
+      mesh_data->begin_output_step(outputFileIdx, time_label);
+      mesh_data->write_defined_output_fields(outputFileIdx);
+      for (auto& it : vector_states)
+      {
+        mesh_data->write_global (outputFileIdx, it.first, it.second);
+      }
+      for (auto& it : integer_states)
+      {
+        mesh_data->write_global (outputFileIdx, it.first, it.second);
+      }
+      mesh_data->end_output_step(outputFileIdx);
+    });
+
+  if (mapT->getComm()->getRank()==0) {
+    *out << "Albany::STKDiscretization::writeSolution: writing time " << time;
+    if (time_label != time) *out << " with label " << time_label;
+    *out << " in background to file "<<stkMeshStruct->exoOutFile<< std::endl;
+  }
+#endif
+}
+
+void
+Albany::STKDiscretization::waitForAsyncExodusOutput()
+{
+#ifdef ALBANY_SEACAS
+  // get() rethrows any exception thrown by the writer
+  if (asyncExodusOutput.valid())
+    asyncExodusOutput.get();
+#endif
+}
+
 double
 Albany::STKDiscretization::monotonicTimeLabel(const double time)
 {
@@ -1696,6 +1763,84 @@ void Albany::STKDiscretization::insertPeridigmNonzerosIntoGraph()
 #endif
 }
 
+void Albany::STKDiscretization::computeJacobianOffsets()
+{
+  // The scatter evaluators address the overlapped Jacobian with overlap
+  // LIDs for both rows and columns, and the graph rows are sorted after
+  // fillComplete, so each element entry is found with a binary search once
+  // here instead of on every sumIntoLocalValues call.
+  const auto row_map = overlap_graphT->getLocalGraph().row_map;
+
+  const int numWorksets = wsElNodeEqID.size();
+  wsJacOffsets.resize(numWorksets);
+
+  Teuchos::ArrayView<const LO> indices;
+
+  for (int ws = 0; ws < numWorksets; ws++) {
+    const WorksetConn& nodeID = wsElNodeEqID[ws];
+    const int numCells = nodeID.dimension(0);
+    const int numNodes = nodeID.dimension(1);
+    const int numEqs = nodeID.dimension(2);
+    const int nunk = numNodes*numEqs;
+
+    wsJacOffsets[ws] = WorksetJacOffsets("wsJacOffsets", numCells, nunk, nunk);
+
+    for (int cell = 0; cell < numCells; cell++) {
+      for (int row_unk = 0; row_unk < nunk; row_unk++) {
+        const LO row = nodeID(cell, row_unk/numEqs, row_unk%numEqs);
+        overlap_graphT->getLocalRowView(row, indices);
+        for (int col_unk = 0; col_unk < nunk; col_unk++) {
+          const LO col = nodeID(cell, col_unk/numEqs, col_unk%numEqs);
+          const LO* it = std::lower_bound(indices.begin(), indices.end(), col);
+          wsJacOffsets[ws](cell, row_unk, col_unk) =
+            (it != indices.end() && *it == col) ?
+            row_map(row) + (it - indices.begin()) : -1;
+        }
+      }
+    }
+  }
+}
+
+void Albany::STKDiscretization::packWorksetInfo()
+{
+  const int numWorksets = coords.size();
+  packedCoords.resize(numWorksets);
+
+  const int numDim = stkMeshStruct->numDim;
+
+  for (int ws = 0; ws < numWorksets; ws++) {
+    const int numCells = coords[ws].size();
+    const int numNodes = numCells > 0 ? coords[ws][0].size() : 0;
+
+    packedCoords[ws] = WorksetCoords("packedCoords", numCells, numNodes, numDim);
+  }
+
+  packWorksetCoords();
+}
+
+void Albany::STKDiscretization::coordinatesChanged()
+{
+  packWorksetCoords();
+  ++meshVersion;
+}
+
+void Albany::STKDiscretization::packWorksetCoords()
+{
+  // Coordinates are read through the pointers of coords, which already
+  // account for the periodic BC replacements made in computeWorksetInfo
+  for (int ws = 0; ws < packedCoords.size(); ws++) {
+    const WorksetCoords& wsCoords = packedCoords[ws];
+    const int numCells = wsCoords.dimension(0);
+    const int numNodes = wsCoords.dimension(1);
+    const int numDim = wsCoords.dimension(2);
+
+    for (int dim = 0; dim < numDim; dim++)
+      for (int node = 0; node < numNodes; node++)
+        for (int cell = 0; cell < numCells; cell++)
+          wsCoords(cell, node, dim) = coords[ws][cell][node][dim];
+  }
+}
+
 void Albany::STKDiscretization::computeWorksetInfo()
 {
 
@@ -2356,6 +2501,8 @@ void Albany::STKDiscretization::computeNodeSets()
 void Albany::STKDiscretization::setupExodusOutput()
 {
 #ifdef ALBANY_SEACAS
+  waitForAsyncExodusOutput();
+
   if (stkMeshStruct->exoOutput) {
 
     outputInterval = 0;
@@ -2364,7 +2511,14 @@ void Albany::STKDiscretization::setupExodusOutput()
 
     Ioss::Init::Initializer io;
 
-    mesh_data = Teuchos::rcp(new stk::io::StkMeshIoBroker(Albany::getMpiCommFromTeuchosComm(commT)));
+    // The background writer communicates on a duplicate, so its collectives
+    // never interleave with the solver's on commT
+    Teuchos::RCP<const Teuchos_Comm> outputCommT = commT;
+    if (stkMeshStruct->exoOutputAsync) {
+      if (asyncOutputCommT.is_null()) asyncOutputCommT = commT->duplicate();
+      outputCommT = asyncOutputCommT;
+    }
+    mesh_data = Teuchos::rcp(new stk::io::StkMeshIoBroker(Albany::getMpiCommFromTeuchosComm(outputCommT)));
     mesh_data->set_bulk_data(bulkData);
     outputFileIdx = mesh_data->create_output_mesh(str, stk::io::WRITE_RESULTS);
 
@@ -2380,12 +2534,26 @@ void Albany::STKDiscretization::setupExodusOutput()
       mesh_data->add_global (outputFileIdx, it.first, mvs, stk::util::ParameterType::INTEGER);
     }
 
+    // With asynchronous output, the staging copies are written under the
+    // names of the fields they shadow
+    std::map<const stk::mesh::FieldBase*,stk::mesh::FieldBase*> staging;
+    std::set<const stk::mesh::FieldBase*> is_staging;
+    for (auto& it : stkMeshStruct->asyncOutputFields) {
+      staging[it.first] = it.second;
+      is_staging.insert(it.second);
+    }
+
     const stk::mesh::FieldVector &fields = mesh_data->meta_data().get_fields();
     for (size_t i=0; i < fields.size(); i++) {
+      if (is_staging.count(fields[i]) > 0) continue;
       // Hacky, but doesn't appear to be a way to query if a field is already
       // going to be output.
       try {
-        mesh_data->add_field(outputFileIdx, *fields[i]);
+        auto it = staging.find(fields[i]);
+        if (it != staging.end())
+          mesh_data->add_field(outputFileIdx, *it->second, fields[i]->name());
+        else
+          mesh_data->add_field(outputFileIdx, *fields[i]);
       }
       catch (std::runtime_error const&) { }
     }
@@ -2866,6 +3034,8 @@ void Albany::STKDiscretization::setupNetCDFOutput()
 void Albany::STKDiscretization::reNameExodusOutput(std::string& filename)
 {
 #ifdef ALBANY_SEACAS
+  waitForAsyncExodusOutput();
+
   if (stkMeshStruct->exoOutput && !mesh_data.is_null()) {
     // Delete the mesh data object and recreate it
     mesh_data = Teuchos::null;
@@ -3136,6 +3306,11 @@ void Albany::STKDiscretization::buildSideSetProjectors()
 void
 Albany::STKDiscretization::updateMesh()
 {
+  // The background writer reads the mesh; it must be done before it changes
+  waitForAsyncExodusOutput();
+
+  ++meshVersion;
+
   const Albany::StateInfoStruct& nodal_param_states = stkMeshStruct->getFieldContainer()->getNodalParameterSIS();
   nodalDOFsStructContainer.addEmptyDOFsStruct("ordinary_solution", "", neq);
   nodalDOFsStructContainer.addEmptyDOFsStruct("mesh_nodes", "", 1);
@@ -3173,6 +3348,12 @@ Albany::STKDiscretization::updateMesh()
   computeGraphs();
 
   computeWorksetInfo();
+
+  if (discParams->get("Precompute Jacobian Offsets", false))
+    computeJacobianOffsets();
+
+  if (discParams->get("Pack Workset Coordinates", false))
+    packWorksetInfo();
 #ifdef OUTPUT_TO_SCREEN
   printConnectivity();
 #endif
@@ -10,6 +10,7 @@
 
 #include <vector>
 #include <utility>
+#include <future>
 
 #include "Albany_AbstractDiscretization.hpp"
 #include "Albany_AbstractSTKMeshStruct.hpp"
@@ -170,6 +171,13 @@ namespace Albany {
     const NodeSetGIDsList& getNodeSetGIDs() const { return nodeSetGIDs; };
     const NodeSetCoordList& getNodeSetCoords() const { return nodeSetCoords; };
 
+    //! Counter bumped whenever the mesh topology or node coordinates change.
+    //! Lets clients cache geometric searches across evaluations.
+    int getMeshVersion() const { return meshVersion; }
+
+    //! Repack the workset coordinates and bump the mesh version
+    void coordinatesChanged();
+
     //! Get Side set lists (typedef in Albany_AbstractDiscretization.hpp)
     const SideSetList& getSideSets(const int workset) const { return sideSets[workset]; };
 
@@ -182,6 +190,9 @@ namespace Albany {
     using Albany::AbstractDiscretization::Conn;
     const Conn& getWsElNodeEqID() const;
 
+    //! Get map from (Ws, El, Local Unk Row, Local Unk Col) -> Jacobian value offset
+    const JacOffsets& getWsJacobianOffsets() const { return wsJacOffsets; }
+
     //! Get map from (Ws, Local Node) -> NodeGID
     const Albany::WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> > >::type& getWsElNodeID() const;
 
@@ -206,6 +217,10 @@ namespace Albany {
 #endif
 
     const Albany::WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*> > >::type& getCoords() const;
+
+    //! Retrieve packed coordinates (ws)(el, node, dim)
+    const PackedCoords& getPackedCoords() const { return packedCoords; }
+
     const Albany::WorksetArray<Teuchos::ArrayRCP<double> >::type& getSphereVolume() const;
     const Albany::WorksetArray<Teuchos::ArrayRCP<double*> >::type& getLatticeOrientation() const;
 
@@ -387,12 +402,22 @@ namespace Albany {
     void computeOverlapNodesAndUnknowns();
     //! Process STK mesh for Workset/Bucket Info
     void computeWorksetInfo();
+    //! Locate the element Jacobian entries in the overlapped graph
+    void computeJacobianOffsets();
+    //! Copy workset coordinates into contiguous views
+    void packWorksetInfo();
+    //! Refresh the packed coordinates after the mesh has moved
+    void packWorksetCoords();
     //! Process STK mesh for NodeSets
     void computeNodeSets();
     //! Process STK mesh for SideSets
     void computeSideSets();
     //! Call stk_io for creating exodus output file
     void setupExodusOutput();
+    //! Write one Exodus output step, in the background if asynchronous output is on
+    void writeExodusOutputStep(const double time, const double time_label);
+    //! Wait for the asynchronous Exodus output step in flight, if any
+    void waitForAsyncExodusOutput();
     //! Call stk_io for creating NetCDF output file
     void setupNetCDFOutput();
 
@@ -483,6 +508,9 @@ namespace Albany {
     //! Connectivity array [workset, element, local-node, Eq] => LID
     Conn wsElNodeEqID;
 
+    //! Jacobian offsets [workset, element, local-unk, local-unk] => value offset
+    JacOffsets wsJacOffsets;
+
     //! Connectivity array [workset, element, local-node] => GID
     Albany::WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> > >::type wsElNodeID;
 
@@ -491,6 +519,12 @@ namespace Albany {
     Albany::WorksetArray<std::string>::type wsEBNames;
     Albany::WorksetArray<int>::type wsPhysIndex;
     Albany::WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*> > >::type coords;
+
+    //! Packed copy of coords, if requested
+    PackedCoords packedCoords;
+
+    //! Incremented by updateMesh and when coordinates are moved
+    int meshVersion = 0;
     Albany::WorksetArray<Teuchos::ArrayRCP<double> >::type sphereVolume;
     Albany::WorksetArray<Teuchos::ArrayRCP<double*> >::type latticeOrientation;
 
@@ -546,11 +580,18 @@ namespace Albany {
 
     // Used in Exodus writing capability
 #ifdef ALBANY_SEACAS
+    //! Communicator of the asynchronous Exodus writer, declared before
+    //! mesh_data so that it outlives it
+    Teuchos::RCP<const Teuchos_Comm> asyncOutputCommT;
+
     Teuchos::RCP<stk::io::StkMeshIoBroker> mesh_data;
 
     int outputInterval;
 
     size_t outputFileIdx;
+
+    //! Asynchronous Exodus output step in flight (at most one)
+    std::future<void> asyncExodusOutput;
 #endif
     bool interleavedOrdering;
 
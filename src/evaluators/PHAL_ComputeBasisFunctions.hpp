@@ -40,6 +40,8 @@ public:
 
 private:
 
+  void computeBasisFunctions();
+
   typedef typename EvalT::MeshScalarT MeshScalarT;
   int  numVertices, numDims, numNodes, numQPs, numCells;
 
@@ -57,6 +59,9 @@ private:
   Kokkos::DynRankView<MeshScalarT, PHX::Device> jacobian;
   Kokkos::DynRankView<MeshScalarT, PHX::Device> jacobian_inv;
 
+  //! Key of the values of this basis in Workset::geometryCache
+  std::string cacheKey;
+
   // Output:
   //! Basis Functions at quadrature points
   PHX::MDField<MeshScalarT,Cell,QuadPoint> weighted_measure;
@@ -9,8 +9,26 @@
 
 #include "Intrepid2_FunctionSpaceTools.hpp"
 
+#include <sstream>
+
 namespace PHAL {
 
+//! Copies between cached RealType geometry and the evaluated fields; a
+//! no-op for mesh scalars carrying shape derivatives, which are not cached.
+template<typename MeshScalarT>
+struct GeometryCacheCopy {
+  static const bool cacheable = false;
+  template<typename Dst, typename Src>
+  static void copy(const Dst&, const Src&) {}
+};
+
+template<>
+struct GeometryCacheCopy<RealType> {
+  static const bool cacheable = true;
+  template<typename Dst, typename Src>
+  static void copy(const Dst& dst, const Src& src) { Kokkos::deep_copy(dst, src); }
+};
+
 template<typename EvalT, typename Traits>
 ComputeBasisFunctions<EvalT, Traits>::
 ComputeBasisFunctions(const Teuchos::ParameterList& p,
@@ -48,6 +66,13 @@ ComputeBasisFunctions(const Teuchos::ParameterList& p,
   dl->vertices_vector->dimensions(dims);
   numVertices = dims[1];
 
+  // Evaluators of all evaluation types with the same basis and quadrature
+  // share the cached values
+  std::ostringstream key;
+  key << BF.fieldTag().name() << ":" << cellType->getName() << ":"
+      << intrepidBasis->getCardinality() << ":" << numQPs;
+  cacheKey = key.str();
+
   this->setName("ComputeBasisFunctions"+PHX::typeAsString<EvalT>());
 }
 
@@ -95,6 +120,54 @@ evaluateFields(typename Traits::EvalData workset)
   //int containerSize = workset.numCells;
     */
 
+  // Basis functions of a static mesh are kept across evaluations; they only
+  // depend on the coordinates when MeshScalarT is RealType
+  if (!workset.geometryCache.is_null() && GeometryCacheCopy<MeshScalarT>::cacheable) {
+    GeometryCache& cache = *workset.geometryCache;
+    const std::shared_ptr<GeometryCache::Entry> entry =
+      cache.get(workset.wsIndex, cacheKey);
+
+    if (!entry->filled) {
+      computeBasisFunctions();
+
+      entry->weighted_measure = Kokkos::DynRankView<RealType, PHX::Device>("weighted_measure", numCells, numQPs);
+      entry->jacobian_det = Kokkos::DynRankView<RealType, PHX::Device>("jacobian_det", numCells, numQPs);
+      entry->wBF = Kokkos::DynRankView<RealType, PHX::Device>("wBF", numCells, numNodes, numQPs);
+      entry->GradBF = Kokkos::DynRankView<RealType, PHX::Device>("GradBF", numCells, numNodes, numQPs, numDims);
+      entry->wGradBF = Kokkos::DynRankView<RealType, PHX::Device>("wGradBF", numCells, numNodes, numQPs, numDims);
+      GeometryCacheCopy<MeshScalarT>::copy(entry->weighted_measure, weighted_measure.get_view());
+      GeometryCacheCopy<MeshScalarT>::copy(entry->jacobian_det, jacobian_det.get_view());
+      GeometryCacheCopy<MeshScalarT>::copy(entry->wBF, wBF.get_view());
+      GeometryCacheCopy<MeshScalarT>::copy(entry->GradBF, GradBF.get_view());
+      GeometryCacheCopy<MeshScalarT>::copy(entry->wGradBF, wGradBF.get_view());
+      if (!cache.referenceBF()) {
+        entry->BF = Kokkos::DynRankView<RealType, PHX::Device>("BF", numCells, numNodes, numQPs);
+        Kokkos::deep_copy(entry->BF, BF.get_view());
+      }
+      entry->filled = true;
+      return;
+    }
+
+    GeometryCacheCopy<MeshScalarT>::copy(weighted_measure.get_view(), entry->weighted_measure);
+    GeometryCacheCopy<MeshScalarT>::copy(jacobian_det.get_view(), entry->jacobian_det);
+    GeometryCacheCopy<MeshScalarT>::copy(wBF.get_view(), entry->wBF);
+    GeometryCacheCopy<MeshScalarT>::copy(GradBF.get_view(), entry->GradBF);
+    GeometryCacheCopy<MeshScalarT>::copy(wGradBF.get_view(), entry->wGradBF);
+    if (cache.referenceBF())
+      Intrepid2::FunctionSpaceTools<PHX::Device>::HGRADtransformVALUE(BF.get_view(), val_at_cub_points);
+    else
+      Kokkos::deep_copy(BF.get_view(), entry->BF);
+    return;
+  }
+
+  computeBasisFunctions();
+}
+
+//**********************************************************************
+template<typename EvalT, typename Traits>
+void ComputeBasisFunctions<EvalT, Traits>::
+computeBasisFunctions()
+{
   typedef typename Intrepid2::CellTools<PHX::Device>   ICT;
   typedef Intrepid2::FunctionSpaceTools<PHX::Device>   IFST;
 
@@ -68,12 +68,26 @@ void GatherCoordinateVector<EvalT, Traits>::evaluateFields(typename Traits::Eval
   unsigned int numCells = workset.numCells;
   Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*> > wsCoords = workset.wsCoords;
 
+  const Albany::AbstractDiscretization::WorksetCoords& packedCoords = workset.wsPackedCoords;
+  const bool packed = packedCoords.size() > 0;
+
 #ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
   if( dispVecName.is_null() ){
-    for (std::size_t cell=0; cell < numCells; ++cell) {
-      for (std::size_t node = 0; node < numVertices; ++node) {
-        for (std::size_t eq=0; eq < numDim; ++eq) { 
-          coordVec(cell,node,eq) = wsCoords[cell][node][eq]; 
+    if (packed) {
+      // The packed coordinates are contiguous along the cells
+      for (std::size_t eq=0; eq < numDim; ++eq) {
+        for (std::size_t node = 0; node < numVertices; ++node) {
+          for (std::size_t cell=0; cell < numCells; ++cell) {
+            coordVec(cell,node,eq) = packedCoords(cell,node,eq);
+          }
+        }
+      }
+    } else {
+      for (std::size_t cell=0; cell < numCells; ++cell) {
+        for (std::size_t node = 0; node < numVertices; ++node) {
+          for (std::size_t eq=0; eq < numDim; ++eq) { 
+            coordVec(cell,node,eq) = wsCoords[cell][node][eq]; 
+          }
         }
       }
     }
@@ -97,10 +111,20 @@ void GatherCoordinateVector<EvalT, Traits>::evaluateFields(typename Traits::Eval
 
     Albany::MDArray dVec = it->second;
 
-    for (std::size_t cell=0; cell < numCells; ++cell) {
-      for (std::size_t node = 0; node < numVertices; ++node) {
-        for (std::size_t eq=0; eq < numDim; ++eq) { 
-          coordVec(cell,node,eq) = wsCoords[cell][node][eq] + dVec(cell,node,eq);
+    if (packed) {
+      for (std::size_t eq=0; eq < numDim; ++eq) {
+        for (std::size_t node = 0; node < numVertices; ++node) {
+          for (std::size_t cell=0; cell < numCells; ++cell) {
+            coordVec(cell,node,eq) = packedCoords(cell,node,eq) + dVec(cell,node,eq);
+          }
+        }
+      }
+    } else {
+      for (std::size_t cell=0; cell < numCells; ++cell) {
+        for (std::size_t node = 0; node < numVertices; ++node) {
+          for (std::size_t eq=0; eq < numDim; ++eq) { 
+            coordVec(cell,node,eq) = wsCoords[cell][node][eq] + dVec(cell,node,eq);
+          }
         }
       }
     }
@@ -124,10 +148,20 @@ void GatherCoordinateVector<EvalT, Traits>::evaluateFields(typename Traits::Eval
  host_view_type coordVecHost = Kokkos::create_mirror_view (coordVec.get_static_view());
 
   if( dispVecName.is_null() ){
-    for (std::size_t cell=0; cell < numCells; ++cell) {
-      for (std::size_t node = 0; node < numVertices; ++node) {
-        for (std::size_t eq=0; eq < numDim; ++eq) {
-          coordVecHost(cell,node,eq) = wsCoords[cell][node][eq];
+    if (packed) {
+      for (std::size_t eq=0; eq < numDim; ++eq) {
+        for (std::size_t node = 0; node < numVertices; ++node) {
+          for (std::size_t cell=0; cell < numCells; ++cell) {
+            coordVecHost(cell,node,eq) = packedCoords(cell,node,eq);
+          }
+        }
+      }
+    } else {
+      for (std::size_t cell=0; cell < numCells; ++cell) {
+        for (std::size_t node = 0; node < numVertices; ++node) {
+          for (std::size_t eq=0; eq < numDim; ++eq) {
+            coordVecHost(cell,node,eq) = wsCoords[cell][node][eq];
+          }
         }
       }
     }
@@ -148,10 +182,20 @@ void GatherCoordinateVector<EvalT, Traits>::evaluateFields(typename Traits::Eval
 
     Albany::MDArray dVec = it->second;
 
-    for (std::size_t cell=0; cell < numCells; ++cell) {
-      for (std::size_t node = 0; node < numVertices; ++node) {
-        for (std::size_t eq=0; eq < numDim; ++eq) {
-          coordVecHost(cell,node,eq) = wsCoords[cell][node][eq] + dVec(cell,node,eq);
+    if (packed) {
+      for (std::size_t eq=0; eq < numDim; ++eq) {
+        for (std::size_t node = 0; node < numVertices; ++node) {
+          for (std::size_t cell=0; cell < numCells; ++cell) {
+            coordVecHost(cell,node,eq) = packedCoords(cell,node,eq) + dVec(cell,node,eq);
+          }
+        }
+      }
+    } else {
+      for (std::size_t cell=0; cell < numCells; ++cell) {
+        for (std::size_t node = 0; node < numVertices; ++node) {
+          for (std::size_t eq=0; eq < numDim; ++eq) {
+            coordVecHost(cell,node,eq) = wsCoords[cell][node][eq] + dVec(cell,node,eq);
+          }
         }
       }
     }
@@ -221,6 +265,8 @@ evaluateFields(typename Traits::EvalData workset)
   unsigned int numCells = workset.numCells;
 
   Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*> > wsCoords = workset.wsCoords;
+  const Albany::AbstractDiscretization::WorksetCoords& packedCoords = workset.wsPackedCoords;
+  const bool packed = packedCoords.size() > 0;
   const Teuchos::ArrayRCP<Teuchos::ArrayRCP<Teuchos::ArrayRCP<Teuchos::ArrayRCP<double> > > > & ws_coord_derivs = workset.ws_coord_derivs;
   std::vector<int> *coord_deriv_indices = workset.coord_deriv_indices;
   int numShapeDerivs = ws_coord_derivs.size();
@@ -229,7 +275,8 @@ evaluateFields(typename Traits::EvalData workset)
   for (std::size_t cell=0; cell < numCells; ++cell) {
     for (std::size_t node = 0; node < numVertices; ++node) {
       for (std::size_t eq=0; eq < numDim; ++eq) { 
-        coordVec(cell,node,eq) = TanFadType(numParams, wsCoords[cell][node][eq]); 
+        const double x = packed ? packedCoords(cell,node,eq) : wsCoords[cell][node][eq];
+        coordVec(cell,node,eq) = TanFadType(numParams, x);
         for (int j=0; j < numShapeDerivs; ++j) { 
           coordVec(cell,node,eq).fastAccessDx((*coord_deriv_indices)[j]) 
                =  ws_coord_derivs[j][cell][node][eq];
@@ -38,6 +38,7 @@ private:
   PHX::MDField<ScalarT> data;
   std::string fieldName;
   std::string stateName;
+  int stateHandle;
 };
 
 template<typename EvalT, typename Traits>
@@ -60,6 +61,7 @@ private:
   PHX::MDField<ParamScalarT> data;
   std::string fieldName;
   std::string stateName;
+  int stateHandle;
 };
 
 
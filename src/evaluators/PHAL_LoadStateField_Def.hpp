@@ -4,6 +4,8 @@
 //    in the file "license.txt" in the top-level Albany directory  //
 //*****************************************************************//
 
+#include <algorithm>
+#include <type_traits>
 #include <vector>
 #include <string>
 
@@ -13,9 +15,45 @@
 
 namespace PHAL {
 
+// Copy a state into a field; the cells past the end of the state (the last
+// workset may be short) are zeroed.
+template<typename ScalarType>
+inline void loadStateValues(PHX::MDField<ScalarType>& data, const Albany::MDArray& state)
+{
+  PHAL::MDFieldIterator<ScalarType> d(data);
+  for (int i = 0; ! d.done() && i < state.size(); ++d, ++i)
+    *d = state[i];
+  for ( ; ! d.done(); ++d) *d = 0.;
+}
+
+// The state is row-major. When the field is too (LayoutRight, or rank 1), a
+// RealType field is filled with two block copies; otherwise, e.g. LayoutLeft
+// on CUDA, a flat copy would transpose it and the element-wise copy is used.
+inline void loadStateValues(PHX::MDField<RealType>& data, const Albany::MDArray& state)
+{
+  const auto view = data.get_view();
+  typedef typename std::decay<decltype(view)>::type ViewType;
+  const bool rowMajor =
+    std::is_same<typename ViewType::array_layout, Kokkos::LayoutRight>::value || data.rank() <= 1;
+  if (!rowMajor || !view.span_is_contiguous()) {
+    loadStateValues<RealType>(data, state);
+    return;
+  }
+
+  typedef Kokkos::View<RealType*, PHX::Device, Kokkos::MemoryUnmanaged> FlatView;
+  const std::size_t size = data.size();
+  const std::size_t n = std::min<std::size_t>(state.size(), size);
+  Kokkos::deep_copy(FlatView(view.data(), n),
+                    Kokkos::View<const RealType*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>(
+                      state.contiguous_data(), n));
+  if (n < size)
+    Kokkos::deep_copy(FlatView(view.data() + n, size - n), 0.0);
+}
+
 template<typename EvalT, typename Traits, typename ScalarType>
 LoadStateFieldBase<EvalT, Traits, ScalarType>::
-LoadStateFieldBase(const Teuchos::ParameterList& p)
+LoadStateFieldBase(const Teuchos::ParameterList& p) :
+  stateHandle(-1)
 {  
   fieldName =  p.get<std::string>("Field Name");
   stateName =  p.get<std::string>("State Name");
@@ -42,18 +80,17 @@ void LoadStateFieldBase<EvalT, Traits, ScalarType>::evaluateFields(typename Trai
   //cout << "LoadStateFieldBase importing state " << stateName << " to field "
   //     << fieldName << " with size " << data.size() << endl;
 
-  const Albany::MDArray& stateToLoad = (*workset.stateArrayPtr)[stateName];
-  PHAL::MDFieldIterator<ScalarType> d(data);
-  for (int i = 0; ! d.done() && i < stateToLoad.size(); ++d, ++i)
-    *d = stateToLoad[i];
-  for ( ; ! d.done(); ++d) *d = 0.;
+  if (stateHandle < 0)
+    stateHandle = PHAL::getStateHandle(workset, stateName);
+  loadStateValues(data, PHAL::getStateArray(workset, stateHandle, stateName));
 }
 
 
 
 template<typename EvalT, typename Traits>
 LoadStateField<EvalT, Traits>::
-LoadStateField(const Teuchos::ParameterList& p) 
+LoadStateField(const Teuchos::ParameterList& p) :
+  stateHandle(-1)
 {  
   fieldName =  p.get<std::string>("Field Name");
   stateName =  p.get<std::string>("State Name");
@@ -80,11 +117,9 @@ void LoadStateField<EvalT, Traits>::evaluateFields(typename Traits::EvalData wor
   //cout << "LoadStateField importing state " << stateName << " to field " 
   //     << fieldName << " with size " << data.size() << endl;
 
-  const Albany::MDArray& stateToLoad = (*workset.stateArrayPtr)[stateName];
-  PHAL::MDFieldIterator<ParamScalarT> d(data);
-  for (int i = 0; ! d.done() && i < stateToLoad.size(); ++d, ++i)
-    *d = stateToLoad[i];
-  for ( ; ! d.done(); ++d) *d = 0.;
+  if (stateHandle < 0)
+    stateHandle = PHAL::getStateHandle(workset, stateName);
+  loadStateValues(data, PHAL::getStateArray(workset, stateHandle, stateName));
 }
 
 // **********************************************************************
@@ -213,6 +213,9 @@ protected:
   Kokkos::DynRankView<MeshScalarT, PHX::Device> temporary_buffer;
   Kokkos::DynRankView<ScalarT, PHX::Device> data_buffer;  
 
+  //! Slot of this evaluator in the workset scratch peak usage
+  int scratchUser;
+
   Kokkos::DynRankView<ScalarT, PHX::Device> data;
 
   // Output:
@@ -364,6 +364,7 @@ postRegistrationSetup(typename Traits::SetupData d,
                       PHX::FieldManager<Traits>& fm)
 {
   this->utils.setFieldData(coordVec,fm);
+  scratchUser = PHAL::WorksetScratch::registerUser(this->getName());
   if (inputConditions == "robin")
   {
     this->utils.setFieldData(dof,fm);
@@ -545,45 +546,41 @@ evaluateNeumannContribution(typename Traits::EvalData workset)
   //! In this way we can group them and call Intrepid2 function for a group of cells, which is more effective.
   //! At this point we do not know the number of blocks in this workset (If we assumed to have elements of the same block in a workset we could skip some of this).
   //! Also we do not know before the evaluator how many cells are associated to a local side id.
-
-  std::map<int, int> ordinalEbIndex;
-  std::vector<int> ebIndexVec;
-  std::vector<std::vector<int> > numCellsOnSidesOnBlocks;
-  std::vector<std::vector<Kokkos::DynRankView<int, PHX::Device> > > cellsOnSidesOnBlocks;
-  for (auto const& it_side : sideSet) {
-    const int ebIndex = it_side.elem_ebIndex;
-    const int elem_LID = it_side.elem_LID;
-    const int elem_side = it_side.side_local_id;
-
-    if(ordinalEbIndex.insert(std::pair<int,int>(ebIndex,ordinalEbIndex.size())).second) {
-      numCellsOnSidesOnBlocks.push_back(std::vector<int>(numSidesOnElem, 0));
-      ebIndexVec.push_back(ebIndex);
-    }
-
-    numCellsOnSidesOnBlocks[ordinalEbIndex[ebIndex]][elem_side]++;
+  //! The lists live in the workset scratch arena: cellsOnSides holds the cells of
+  //! (block ib, side is) at [sideOffsets[ib*numSidesOnElem+is], sideOffsets[ib*numSidesOnElem+is+1]).
+
+  PHAL::ScratchScope scratch(workset.scratch, scratchUser);
+  const int numSideCells = sideSet.size();
+  int* ebIndexVec = scratch.allocate<int>(numSideCells);
+  int* blockOfSide = scratch.allocate<int>(numSideCells);
+  int numBlocks = 0;
+  for (int i=0; i<numSideCells; i++) {
+    const int ebIndex = sideSet[i].elem_ebIndex;
+    int ib = 0;
+    while (ib < numBlocks && ebIndexVec[ib] != ebIndex) ib++;
+    if (ib == numBlocks) ebIndexVec[numBlocks++] = ebIndex;
+    blockOfSide[i] = ib;
   }
-  cellsOnSidesOnBlocks.resize(ordinalEbIndex.size());
-  for (int ib=0; ib<ordinalEbIndex.size(); ib++) {
-    cellsOnSidesOnBlocks[ib].resize(numSidesOnElem);
-    for (int is=0; is<numSidesOnElem; is++) {
-      cellsOnSidesOnBlocks[ib][is] = Kokkos::DynRankView<int, PHX::Device>("cellOnSide_i", numCellsOnSidesOnBlocks[ib][is]);
-      numCellsOnSidesOnBlocks[ib][is]=0;
-    }
-  }
-
-  for (auto const& it_side : sideSet) {
-    const int iBlock = ordinalEbIndex[it_side.elem_ebIndex];
-    const int elem_LID = it_side.elem_LID;
-    const int elem_side = it_side.side_local_id;
 
-    cellsOnSidesOnBlocks[iBlock][elem_side](numCellsOnSidesOnBlocks[iBlock][elem_side]++) = elem_LID;
+  int* sideOffsets = scratch.allocate<int>(numBlocks*numSidesOnElem + 1);
+  for (int i=0; i<numSideCells; i++)
+    sideOffsets[blockOfSide[i]*numSidesOnElem + sideSet[i].side_local_id + 1]++;
+  for (int k=0; k<numBlocks*numSidesOnElem; k++)
+    sideOffsets[k+1] += sideOffsets[k];
+
+  int* cellsOnSides = scratch.allocate<int>(numSideCells);
+  int* sideFill = scratch.allocate<int>(numBlocks*numSidesOnElem);
+  for (int i=0; i<numSideCells; i++) {
+    const int k = blockOfSide[i]*numSidesOnElem + sideSet[i].side_local_id;
+    cellsOnSides[sideOffsets[k] + sideFill[k]++] = sideSet[i].elem_LID;
   }
 
   // Loop over the sides that form the boundary condition
-  for (int iblock = 0; iblock < ordinalEbIndex.size(); ++iblock)
+  for (int iblock = 0; iblock < numBlocks; ++iblock)
   for (int side = 0; side < numSidesOnElem; ++side)
   {
-    int numCells_ =  numCellsOnSidesOnBlocks[iblock][side];
+    const int k = iblock*numSidesOnElem + side;
+    int numCells_ =  sideOffsets[k+1] - sideOffsets[k];
     if( numCells_ == 0) continue;
 
     // Get the data that corresponds to the side
@@ -591,7 +588,7 @@ evaluateNeumannContribution(typename Traits::EvalData workset)
     int sideDims = sideType[side]->getDimension();
     int numQPsSide = cubatureSide[side]->getNumPoints();
 
-    Kokkos::DynRankView<int, PHX::Device> cellVec  = cellsOnSidesOnBlocks[iblock][side];
+    Kokkos::DynRankView<int, PHX::Device> cellVec(cellsOnSides + sideOffsets[k], numCells_);
 
     //need to resize containers because they depend on side topology
     cubPointsSide = DynRankViewRealT(cubPointsSide_buffer.data(), numQPsSide, sideDims);
@@ -0,0 +1,128 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include <algorithm>
+#include <tuple>
+
+#include "PHAL_AlbanyTraits.hpp"
+
+#include "PHAL_ProfiledEvaluator.hpp"
+#include "PHAL_ProfiledEvaluator_Def.hpp"
+
+#include "utility/DisplayTable.hpp"
+#include "utility/PerformanceContext.hpp"
+
+namespace PHAL {
+
+EvaluatorProfiler& EvaluatorProfiler::instance()
+{
+  static EvaluatorProfiler profiler;
+  return profiler;
+}
+
+void EvaluatorProfiler::enable(const std::string& format)
+{
+  TEUCHOS_TEST_FOR_EXCEPTION(format != "Table" && format != "JSON",
+      std::logic_error,
+      "Error! Unknown evaluator profile format " << format
+      << ". Use Table or JSON.\n");
+
+  json_ = format == "JSON";
+  if (enabled_) return;
+  enabled_ = true;
+
+  util::PerformanceContext::instance().addSummary("Evaluator Profile",
+      [this](Teuchos::Ptr<const Teuchos::Comm<int> > comm, std::ostream& out) {
+        summarize(comm, out);
+      });
+}
+
+void EvaluatorProfiler::add(const std::string& eval_type,
+                            const std::string& name,
+                            const std::shared_ptr<BlockStats>& stats)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.push_back({eval_type, name, stats});
+}
+
+void EvaluatorProfiler::reset()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const Entry& entry : entries_)
+    for (auto& block : *entry.stats)
+      block.second = EvaluatorStats();
+}
+
+void EvaluatorProfiler::clear()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.clear();
+}
+
+void EvaluatorProfiler::summarize(
+    Teuchos::Ptr<const Teuchos::Comm<int> > comm, std::ostream& out) const
+{
+  if (comm->getRank() != 0) return;
+
+  // Evaluators built once per thread or per field manager share a row
+  typedef std::tuple<std::string, std::string, std::string> Key;
+  std::map<Key, EvaluatorStats> rows;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const Entry& entry : entries_) {
+      for (const auto& block : *entry.stats) {
+        EvaluatorStats& row =
+          rows[Key(block.first, entry.evalType, entry.name)];
+        row.seconds += block.second.seconds;
+        row.calls += block.second.calls;
+        row.cells += block.second.cells;
+        row.bytesRead += block.second.bytesRead;
+        row.bytesWritten += block.second.bytesWritten;
+      }
+    }
+  }
+
+  std::vector<std::pair<Key, EvaluatorStats> > sorted(rows.begin(), rows.end());
+  std::stable_sort(sorted.begin(), sorted.end(),
+      [](const std::pair<Key, EvaluatorStats>& a,
+         const std::pair<Key, EvaluatorStats>& b) {
+        return a.second.seconds > b.second.seconds;
+      });
+
+  if (json_) {
+    out << "{\"evaluators\": [";
+    for (std::size_t i = 0; i < sorted.size(); ++i) {
+      const Key& key = sorted[i].first;
+      const EvaluatorStats& stats = sorted[i].second;
+      out << (i == 0 ? "\n" : ",\n")
+          << "  {\"block\": \"" << std::get<0>(key)
+          << "\", \"evaluation type\": \"" << std::get<1>(key)
+          << "\", \"evaluator\": \"" << std::get<2>(key)
+          << "\", \"seconds\": " << stats.seconds
+          << ", \"calls\": " << stats.calls
+          << ", \"cells\": " << stats.cells
+          << ", \"bytes read\": " << stats.bytesRead
+          << ", \"bytes written\": " << stats.bytesWritten << "}";
+    }
+    out << "\n]}" << std::endl;
+    return;
+  }
+
+  util::DisplayTable table;
+  table.addRow("Block", "Evaluation Type", "Evaluator", "Seconds", "Calls",
+               "Cells", "Bytes Read", "Bytes Written");
+  for (const auto& row : sorted) {
+    table.addRow(std::get<0>(row.first), std::get<1>(row.first),
+                 std::get<2>(row.first), row.second.seconds, row.second.calls,
+                 row.second.cells, row.second.bytesRead,
+                 row.second.bytesWritten);
+  }
+  table.writeCSV(out);
+}
+
+}
+
+PHAL_INSTANTIATE_TEMPLATE_CLASS(PHAL::ProfiledEvaluator)
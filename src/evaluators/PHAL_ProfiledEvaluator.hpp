@@ -0,0 +1,163 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef PHAL_PROFILED_EVALUATOR_HPP
+#define PHAL_PROFILED_EVALUATOR_HPP
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Phalanx_config.hpp"
+#include "Phalanx_DAG_Manager.hpp"
+#include "Phalanx_FieldManager.hpp"
+#include "Phalanx_Evaluator_WithBaseImpl.hpp"
+#include "Phalanx_Evaluator_Derived.hpp"
+
+#include "Teuchos_Comm.hpp"
+#include "Teuchos_RCP.hpp"
+
+namespace PHAL {
+
+//! Accumulated cost of one evaluator in one element block.
+struct EvaluatorStats {
+  double seconds = 0.0;
+  std::size_t calls = 0;
+  std::size_t cells = 0;
+  std::size_t bytesRead = 0;
+  std::size_t bytesWritten = 0;
+};
+
+/** \brief Registry of the evaluator profiles ("Profile Evaluators").
+ *
+ *  ProfiledEvaluator objects register their statistics here when they are
+ *  built. The registry adds a summary to util::PerformanceContext that lists
+ *  every profiled (element block, evaluation type, evaluator), slowest
+ *  first, as a table or as JSON. The drivers write it once, after the solve.
+ *
+ *  Every evaluator a problem builds through Albany::ConstructEvaluatorsOp
+ *  is wrapped when profiling is on (see registerProfiled); others can opt in
+ *  with profileEvaluator.
+ */
+class EvaluatorProfiler {
+public:
+
+  static EvaluatorProfiler& instance();
+
+  //! Turn profiling on; format is "Table" or "JSON".
+  void enable(const std::string& format);
+  bool enabled() const { return enabled_; }
+
+  //! Statistics per element block of one evaluator, kept by the caller.
+  typedef std::map<std::string, EvaluatorStats> BlockStats;
+
+  void add(const std::string& eval_type, const std::string& name,
+           const std::shared_ptr<BlockStats>& stats);
+
+  //! Zero the statistics of all evaluators, e.g. after warm-up fills.
+  void reset();
+
+  //! Forget all evaluators, e.g. before building another Application.
+  void clear();
+
+  //! Write the profile of this rank; only rank 0 writes.
+  void summarize(Teuchos::Ptr<const Teuchos::Comm<int> > comm,
+                 std::ostream& out) const;
+
+private:
+
+  EvaluatorProfiler() = default;
+
+  struct Entry {
+    std::string evalType;
+    std::string name;
+    std::shared_ptr<BlockStats> stats;
+  };
+
+  bool enabled_ = false;
+  bool json_ = false;
+  mutable std::mutex mutex_;
+  std::vector<Entry> entries_;
+};
+
+/** \brief Times an evaluator and estimates the MDField data it moves.
+ *
+ *  The wrapper takes the name and the fields of the evaluator it wraps, so
+ *  the field manager orders it the same way. Bytes are estimated from the
+ *  layouts of the dependent (read) and evaluated (written) fields for the
+ *  cells of the workset.
+ */
+template<typename EvalT, typename Traits>
+class ProfiledEvaluator : public PHX::EvaluatorWithBaseImpl<Traits>,
+                          public PHX::EvaluatorDerived<EvalT, Traits> {
+
+public:
+
+  explicit ProfiledEvaluator(const Teuchos::RCP<PHX::Evaluator<Traits> >& ev);
+
+  void postRegistrationSetup(typename Traits::SetupData d,
+                             PHX::FieldManager<Traits>& vm);
+
+  void evaluateFields(typename Traits::EvalData d);
+
+  void preEvaluate(typename Traits::PreEvalData d);
+
+  void postEvaluate(typename Traits::PostEvalData d);
+
+private:
+
+  //! Entries of a field (per cell if perCell) and whether it holds plain
+  //! RealType values.
+  struct FieldSize {
+    std::size_t entries;
+    bool perCell;
+    bool isReal;
+  };
+
+  static std::vector<FieldSize>
+  fieldSizes(const std::vector<Teuchos::RCP<PHX::FieldTag> >& tags);
+
+  std::size_t bytes(const std::vector<FieldSize>& sizes,
+                    std::size_t num_cells, std::size_t num_derivs) const;
+
+  Teuchos::RCP<PHX::Evaluator<Traits> > ev_;
+  std::vector<FieldSize> read_;
+  std::vector<FieldSize> written_;
+  std::shared_ptr<EvaluatorProfiler::BlockStats> stats_;
+};
+
+//! Wrap ev in a ProfiledEvaluator if evaluator profiling is on.
+template<typename EvalT, typename Traits>
+Teuchos::RCP<PHX::Evaluator<Traits> >
+profileEvaluator(const Teuchos::RCP<PHX::Evaluator<Traits> >& ev)
+{
+  if (!EvaluatorProfiler::instance().enabled()) return ev;
+  return Teuchos::rcp(new ProfiledEvaluator<EvalT, Traits>(ev));
+}
+
+//! Register the EvalT evaluators of staging in fm, each wrapped in a
+//! ProfiledEvaluator, and require the fields staging requires.
+//
+// Phalanx has no hook on registerEvaluator, so problems build into staging
+// and the evaluators are moved over before fm is set up.
+template<typename EvalT, typename Traits>
+void registerProfiled(const PHX::FieldManager<Traits>& staging,
+                      PHX::FieldManager<Traits>& fm)
+{
+  const PHX::DagManager<Traits>& dag =
+    staging.template getDagManager<EvalT>();
+  for (const auto& node : dag.getDagNodes())
+    fm.template registerEvaluator<EvalT>(
+        profileEvaluator<EvalT, Traits>(node.getNonConst()));
+  for (const auto& tag : dag.getRequiredFields())
+    fm.template requireField<EvalT>(*tag);
+}
+
+}
+
+#endif
@@ -0,0 +1,148 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include <algorithm>
+#include <chrono>
+#include <typeinfo>
+
+#include "Phalanx_DataLayout.hpp"
+#include "Teuchos_TestForException.hpp"
+
+namespace PHAL {
+
+namespace {
+
+// Number of derivative components of the ScalarT of each evaluation type
+template<typename EvalT>
+std::size_t numDerivatives(const PHAL::Workset& workset) { return 0; }
+
+std::size_t maxDerivatives(const std::vector<PHX::index_size_type>& dims)
+{
+  return dims.empty() ? 0 : *std::max_element(dims.begin(), dims.end());
+}
+
+template<>
+std::size_t numDerivatives<PHAL::AlbanyTraits::Jacobian>(const PHAL::Workset& workset)
+{
+  return maxDerivatives(workset.Jacobian_deriv_dims);
+}
+
+template<>
+std::size_t numDerivatives<PHAL::AlbanyTraits::Tangent>(const PHAL::Workset& workset)
+{
+  return maxDerivatives(workset.Tangent_deriv_dims);
+}
+
+}
+
+// **********************************************************************
+template<typename EvalT, typename Traits>
+ProfiledEvaluator<EvalT, Traits>::
+ProfiledEvaluator(const Teuchos::RCP<PHX::Evaluator<Traits> >& ev) :
+  ev_(ev),
+  stats_(std::make_shared<EvaluatorProfiler::BlockStats>())
+{
+  TEUCHOS_TEST_FOR_EXCEPTION(ev.is_null(), std::logic_error,
+      "Error! ProfiledEvaluator needs an evaluator to wrap.\n");
+
+  for (const auto& tag : ev_->evaluatedFields())
+    this->addEvaluatedField(*tag);
+  for (const auto& tag : ev_->dependentFields())
+    this->addDependentField(*tag);
+
+  read_ = fieldSizes(ev_->dependentFields());
+  written_ = fieldSizes(ev_->evaluatedFields());
+
+  this->setName(ev_->getName());
+
+  EvaluatorProfiler::instance().add(PHX::typeAsString<EvalT>(),
+                                    ev_->getName(), stats_);
+}
+
+// **********************************************************************
+template<typename EvalT, typename Traits>
+void ProfiledEvaluator<EvalT, Traits>::
+postRegistrationSetup(typename Traits::SetupData d,
+                      PHX::FieldManager<Traits>& vm)
+{
+  ev_->postRegistrationSetup(d, vm);
+}
+
+// **********************************************************************
+template<typename EvalT, typename Traits>
+void ProfiledEvaluator<EvalT, Traits>::
+evaluateFields(typename Traits::EvalData workset)
+{
+  const auto start = std::chrono::steady_clock::now();
+  ev_->evaluateFields(workset);
+  const std::chrono::duration<double> elapsed =
+    std::chrono::steady_clock::now() - start;
+
+  const std::size_t num_derivs = numDerivatives<EvalT>(workset);
+
+  EvaluatorStats& stats = (*stats_)[workset.EBName];
+  stats.seconds += elapsed.count();
+  stats.calls += 1;
+  stats.cells += workset.numCells;
+  stats.bytesRead += bytes(read_, workset.numCells, num_derivs);
+  stats.bytesWritten += bytes(written_, workset.numCells, num_derivs);
+}
+
+// **********************************************************************
+template<typename EvalT, typename Traits>
+void ProfiledEvaluator<EvalT, Traits>::
+preEvaluate(typename Traits::PreEvalData d)
+{
+  ev_->preEvaluate(d);
+}
+
+// **********************************************************************
+template<typename EvalT, typename Traits>
+void ProfiledEvaluator<EvalT, Traits>::
+postEvaluate(typename Traits::PostEvalData d)
+{
+  ev_->postEvaluate(d);
+}
+
+// **********************************************************************
+template<typename EvalT, typename Traits>
+std::vector<typename ProfiledEvaluator<EvalT, Traits>::FieldSize>
+ProfiledEvaluator<EvalT, Traits>::
+fieldSizes(const std::vector<Teuchos::RCP<PHX::FieldTag> >& tags)
+{
+  std::vector<FieldSize> sizes;
+  for (const auto& tag : tags) {
+    const PHX::DataLayout& layout = tag->dataLayout();
+    // Fields without a leading cell dimension (e.g. shared parameters) are
+    // counted once per call
+    FieldSize size;
+    size.perCell = layout.rank() > 0 && layout.name(0) == "Cell" &&
+                   layout.dimension(0) > 0;
+    size.entries = size.perCell ? layout.size() / layout.dimension(0) :
+                                  layout.size();
+    size.isReal = tag->dataTypeInfo() == typeid(RealType);
+    sizes.push_back(size);
+  }
+  return sizes;
+}
+
+// **********************************************************************
+template<typename EvalT, typename Traits>
+std::size_t ProfiledEvaluator<EvalT, Traits>::
+bytes(const std::vector<FieldSize>& sizes, std::size_t num_cells,
+      std::size_t num_derivs) const
+{
+  std::size_t total = 0;
+  for (const FieldSize& size : sizes) {
+    const std::size_t values = size.isReal ? 1 : 1 + num_derivs;
+    const std::size_t entries =
+      size.perCell ? size.entries * num_cells : size.entries;
+    total += entries * values * sizeof(RealType);
+  }
+  return total;
+}
+
+}
@@ -59,12 +59,17 @@ private:
   void saveNodeState (typename Traits::EvalData d);
   void saveWorksetState (typename Traits::EvalData d);
 
+  const Albany::MDArray& getState (typename Traits::EvalData d);
+  //! Copy the first numCells cells of field to sta as one block, if their layouts allow it
+  bool saveContiguous (const Albany::MDArray& sta, const int numCells);
+
   typedef typename PHAL::AlbanyTraits::Residual::ScalarT ScalarT;
 
   Teuchos::RCP<PHX::FieldTag> savestate_operation;
   PHX::MDField<const ScalarT> field;
   std::string fieldName;
   std::string stateName;
+  int stateHandle;
 
   bool nodalState;
   bool worksetState;
@@ -4,6 +4,7 @@
 //    in the file "license.txt" in the top-level Albany directory  //
 //*****************************************************************//
 
+#include <type_traits>
 #include <vector>
 #include <string>
 
@@ -42,7 +43,8 @@ void SaveStateField<EvalT, Traits>::evaluateFields(typename Traits::EvalData wor
 // **********************************************************************
 template<typename Traits>
 SaveStateField<PHAL::AlbanyTraits::Residual, Traits>::
-SaveStateField(const Teuchos::ParameterList& p)
+SaveStateField(const Teuchos::ParameterList& p) :
+  stateHandle(-1)
 {
   fieldName =  p.get<std::string>("Field Name");
   stateName =  p.get<std::string>("State Name");
@@ -101,18 +103,57 @@ evaluateFields(typename Traits::EvalData workset)
 }
 
 template<typename Traits>
-void SaveStateField<PHAL::AlbanyTraits::Residual, Traits>::
-saveElemState(typename Traits::EvalData workset)
+const Albany::MDArray& SaveStateField<PHAL::AlbanyTraits::Residual, Traits>::
+getState(typename Traits::EvalData workset)
 {
   // Get shards Array (from STK) for this state
-  // Need to check if we can just copy full size -- can assume same ordering?
-  Albany::StateArray::const_iterator it;
-  it = workset.stateArrayPtr->find(stateName);
+  if (stateHandle < 0)
+    stateHandle = PHAL::getStateHandle(workset, stateName);
+  const Albany::MDArray& sta = PHAL::getStateArray(workset, stateHandle, stateName);
 
-  TEUCHOS_TEST_FOR_EXCEPTION((it == workset.stateArrayPtr->end()), std::logic_error,
+  TEUCHOS_TEST_FOR_EXCEPTION((sta.rank() == 0), std::logic_error,
          std::endl << "Error: cannot locate " << stateName << " in PHAL_SaveStateField_Def" << std::endl);
 
-  Albany::MDArray sta = it->second;
+  return sta;
+}
+
+template<typename Traits>
+bool SaveStateField<PHAL::AlbanyTraits::Residual, Traits>::
+saveContiguous(const Albany::MDArray& sta, const int numCells)
+{
+  // The state is row-major. If the field is too (LayoutRight, or rank 1) and
+  // they agree past the cell index, the first numCells cells are a single
+  // block in both; a flat copy from a LayoutLeft field would transpose it.
+  const auto view = field.get_view();
+  typedef typename std::decay<decltype(view)>::type ViewType;
+  const bool rowMajor =
+    std::is_same<typename ViewType::array_layout, Kokkos::LayoutRight>::value || field.rank() <= 1;
+  if (!rowMajor || !view.span_is_contiguous() || static_cast<int>(field.rank()) != sta.rank() ||
+      static_cast<std::size_t>(numCells) > field.dimension(0) ||
+      numCells > static_cast<int>(sta.dimension(0)))
+    return false;
+  std::size_t perCell = 1;
+  for (int i = 1; i < sta.rank(); ++i) {
+    if (field.dimension(i) != static_cast<std::size_t>(sta.dimension(i)))
+      return false;
+    perCell *= sta.dimension(i);
+  }
+
+  const std::size_t n = numCells*perCell;
+  Kokkos::deep_copy(
+    Kokkos::View<RealType*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>(sta.contiguous_data(), n),
+    Kokkos::View<const RealType*, PHX::Device, Kokkos::MemoryUnmanaged>(view.data(), n));
+  return true;
+}
+
+template<typename Traits>
+void SaveStateField<PHAL::AlbanyTraits::Residual, Traits>::
+saveElemState(typename Traits::EvalData workset)
+{
+  const Albany::MDArray& sta = getState(workset);
+  if (saveContiguous(sta, workset.numCells))
+    return;
+
   std::vector<PHX::DataLayout::size_type> dims;
   sta.dimensions(dims);
   int size = dims.size();
@@ -158,15 +199,10 @@ template<typename Traits>
 void SaveStateField<PHAL::AlbanyTraits::Residual, Traits>::
 saveWorksetState(typename Traits::EvalData workset)
 {
-  // Get shards Array (from STK) for this state
-  // Need to check if we can just copy full size -- can assume same ordering?
-  Albany::StateArray::const_iterator it;
-  it = workset.stateArrayPtr->find(stateName);
-
-  TEUCHOS_TEST_FOR_EXCEPTION((it == workset.stateArrayPtr->end()), std::logic_error,
-         std::endl << "Error: cannot locate " << stateName << " in PHAL_SaveStateField_Def" << std::endl);
+  const Albany::MDArray& sta = getState(workset);
+  if (saveContiguous(sta, sta.dimension(0)))
+    return;
 
-  Albany::MDArray sta = it->second;
   std::vector<PHX::DataLayout::size_type> dims;
   sta.dimensions(dims);
   int size = dims.size();
@@ -175,6 +175,7 @@ public:
   struct PHAL_ScatterResRank2_Tag{};
   struct PHAL_ScatterJacRank2_Adjoint_Tag{};
   struct PHAL_ScatterJacRank2_Tag{};
+  struct PHAL_ScatterJacDiag_Tag{};
 
   KOKKOS_INLINE_FUNCTION
   void operator() (const PHAL_ScatterResRank0_Tag&, const int& cell) const;
@@ -197,9 +198,19 @@ public:
   KOKKOS_INLINE_FUNCTION
   void operator() (const PHAL_ScatterJacRank2_Tag&, const int& cell) const;
 
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const PHAL_ScatterJacDiag_Tag&, const int& cell) const;
+
 private:
+  // Adds the derivatives of one residual entry using workset.wsJacOffsets
+  template<typename ValT>
+  KOKKOS_INLINE_FUNCTION
+  void sumIntoJacobianByOffsets(const int cell, const int row_unk,
+                                const ValT& valptr, const bool adjoint) const;
+
   int neq, nunk, numDims;
   Tpetra_CrsMatrix::local_matrix_type JacT_kokkos;
+  Albany::AbstractDiscretization::WorksetJacOffsets jacOffsets;
 
   typedef ScatterResidualBase<PHAL::AlbanyTraits::Jacobian, Traits> Base;
   using Base::nodeID;
@@ -216,6 +227,7 @@ private:
   typedef Kokkos::RangePolicy<ExecutionSpace, PHAL_ScatterResRank2_Tag> PHAL_ScatterResRank2_Policy;
   typedef Kokkos::RangePolicy<ExecutionSpace, PHAL_ScatterJacRank2_Adjoint_Tag> PHAL_ScatterJacRank2_Adjoint_Policy;
   typedef Kokkos::RangePolicy<ExecutionSpace, PHAL_ScatterJacRank2_Tag> PHAL_ScatterJacRank2_Policy;
+  typedef Kokkos::RangePolicy<ExecutionSpace, PHAL_ScatterJacDiag_Tag> PHAL_ScatterJacDiag_Policy;
 
 #endif
 };
@@ -240,6 +240,20 @@ ScatterResidual(const Teuchos::ParameterList& p,
 // **********************************************************************
 // Kokkos kernels
 #ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
+template<typename Traits>
+template<typename ValT>
+KOKKOS_INLINE_FUNCTION
+void ScatterResidual<PHAL::AlbanyTraits::Jacobian,Traits>::
+sumIntoJacobianByOffsets(const int cell, const int row_unk, const ValT& valptr,
+                         const bool adjoint) const
+{
+  for (int lunk=0; lunk<nunk; lunk++) {
+    const LO off = adjoint ? jacOffsets(cell,lunk,row_unk) : jacOffsets(cell,row_unk,lunk);
+    if (off >= 0)
+      Kokkos::atomic_fetch_add(&JacT_kokkos.values(off), valptr.fastAccessDx(lunk));
+  }
+}
+
 template<typename Traits>
 KOKKOS_INLINE_FUNCTION
 void ScatterResidual<PHAL::AlbanyTraits::Jacobian,Traits>::
@@ -277,6 +291,10 @@ operator() (const PHAL_ScatterJacRank0_Adjoint_Tag&, const int& cell) const
     for (int eq = 0; eq < numFields; eq++) {
       rowT = nodeID(cell,node,this->offset + eq);
       auto valptr = val_kokkos[eq](cell,node);
+      if (jacOffsets.size() != 0) {
+        sumIntoJacobianByOffsets(cell, neq*node + this->offset + eq, valptr, true);
+        continue;
+      }
       for (int lunk=0; lunk<nunk; lunk++) {
         ST val = valptr.fastAccessDx(lunk);
         JacT_kokkos.sumIntoValues(colT[lunk], &rowT, 1, &val, false, true); 
@@ -312,6 +330,10 @@ operator() (const PHAL_ScatterJacRank0_Tag&, const int& cell) const
     for (int eq = 0; eq < numFields; eq++) {
       rowT = nodeID(cell,node,this->offset + eq);
       auto valptr = val_kokkos[eq](cell,node);
+      if (jacOffsets.size() != 0) {
+        sumIntoJacobianByOffsets(cell, neq*node + this->offset + eq, valptr, false);
+        continue;
+      }
       for (int i = 0; i < nunk; ++i) vals[i] = valptr.fastAccessDx(i);
       JacT_kokkos.sumIntoValues(rowT, colT, nunk, vals, false, true);
     }
@@ -356,7 +378,10 @@ operator() (const PHAL_ScatterJacRank1_Adjoint_Tag&, const int& cell) const
   for (int node = 0; node < this->numNodes; ++node) {
     for (int eq = 0; eq < numFields; eq++) {
       rowT = nodeID(cell,node,this->offset + eq);
-      if (((this->valVec)(cell,node,eq)).hasFastAccess()) {
+      if (((this->valVec)(cell,node,eq)).hasFastAccess() && jacOffsets.size() != 0) {
+        sumIntoJacobianByOffsets(cell, neq*node + this->offset + eq, (this->valVec)(cell,node,eq), true);
+      }
+      else if (((this->valVec)(cell,node,eq)).hasFastAccess()) {
         for (int lunk=0; lunk<nunk; lunk++){
           ST val = ((this->valVec)(cell,node,eq)).fastAccessDx(lunk);
           JacT_kokkos.sumIntoValues(colT[lunk], &rowT, 1, &val, false, true);
@@ -392,7 +417,10 @@ operator() (const PHAL_ScatterJacRank1_Tag&, const int& cell) const
   for (int node = 0; node < this->numNodes; ++node) {
     for (int eq = 0; eq < numFields; eq++) {
       rowT = nodeID(cell,node,this->offset + eq);
-      if (((this->valVec)(cell,node,eq)).hasFastAccess()) {
+      if (((this->valVec)(cell,node,eq)).hasFastAccess() && jacOffsets.size() != 0) {
+        sumIntoJacobianByOffsets(cell, neq*node + this->offset + eq, (this->valVec)(cell,node,eq), false);
+      }
+      else if (((this->valVec)(cell,node,eq)).hasFastAccess()) {
         for (int i = 0; i < nunk; ++i) vals[i] = (this->valVec)(cell,node,eq).fastAccessDx(i);
         JacT_kokkos.sumIntoValues(rowT, colT, nunk, vals, false, true);
       }
@@ -437,7 +465,10 @@ operator() (const PHAL_ScatterJacRank2_Adjoint_Tag&, const int& cell) const
   for (int node = 0; node < this->numNodes; ++node) {
     for (int eq = 0; eq < numFields; eq++) {
       rowT = nodeID(cell,node,this->offset + eq);
-      if (((this->valTensor)(cell,node, eq/numDims, eq%numDims)).hasFastAccess()) {
+      if (((this->valTensor)(cell,node, eq/numDims, eq%numDims)).hasFastAccess() && jacOffsets.size() != 0) {
+        sumIntoJacobianByOffsets(cell, neq*node + this->offset + eq, (this->valTensor)(cell,node, eq/numDims, eq%numDims), true);
+      }
+      else if (((this->valTensor)(cell,node, eq/numDims, eq%numDims)).hasFastAccess()) {
         for (int lunk=0; lunk<nunk; lunk++) {
           ST val = ((this->valTensor)(cell,node, eq/numDims, eq%numDims)).fastAccessDx(lunk);
           JacT_kokkos.sumIntoValues (colT[lunk], &rowT, 1, &val, false, true);
@@ -473,13 +504,40 @@ operator() (const PHAL_ScatterJacRank2_Tag&, const int& cell) const
   for (int node = 0; node < this->numNodes; ++node) {
     for (int eq = 0; eq < numFields; eq++) {
       rowT = nodeID(cell,node,this->offset + eq);
-      if (((this->valTensor)(cell,node, eq/numDims, eq%numDims)).hasFastAccess()) {
+      if (((this->valTensor)(cell,node, eq/numDims, eq%numDims)).hasFastAccess() && jacOffsets.size() != 0) {
+        sumIntoJacobianByOffsets(cell, neq*node + this->offset + eq, (this->valTensor)(cell,node, eq/numDims, eq%numDims), false);
+      }
+      else if (((this->valTensor)(cell,node, eq/numDims, eq%numDims)).hasFastAccess()) {
         for (int i = 0; i < nunk; ++i) vals[i] = (this->valTensor)(cell,node, eq/numDims, eq%numDims).fastAccessDx(i);
         JacT_kokkos.sumIntoValues(rowT, colT, nunk,  vals, false, true);
       }
     }
   }
 }
+
+template<typename Traits>
+KOKKOS_INLINE_FUNCTION
+void ScatterResidual<PHAL::AlbanyTraits::Jacobian,Traits>::
+operator() (const PHAL_ScatterJacDiag_Tag&, const int& cell) const
+{
+  // Only the derivative of each row with respect to its own unknown
+  for (int node = 0; node < this->numNodes; ++node) {
+    for (int eq = 0; eq < numFields; eq++) {
+      const LO rowT = nodeID(cell,node,this->offset + eq);
+      const int row_unk = neq*node + this->offset + eq;
+      ST val;
+      if (this->tensorRank == 0)
+        val = val_kokkos[eq](cell,node).fastAccessDx(row_unk);
+      else if (this->tensorRank == 1 && (this->valVec)(cell,node,eq).hasFastAccess())
+        val = (this->valVec)(cell,node,eq).fastAccessDx(row_unk);
+      else if (this->tensorRank == 2 && (this->valTensor)(cell,node, eq/numDims, eq%numDims).hasFastAccess())
+        val = (this->valTensor)(cell,node, eq/numDims, eq%numDims).fastAccessDx(row_unk);
+      else
+        continue;
+      JacT_kokkos.sumIntoValues(rowT, &rowT, 1, &val, false, true);
+    }
+  }
+}
 #endif
 
 // **********************************************************************
@@ -499,6 +557,14 @@ evaluateFields(typename Traits::EvalData workset)
   int numDims = 0;
   if (this->tensorRank==2) numDims = this->valTensor.dimension(2);
 
+  // With precomputed offsets the derivatives are added directly into the
+  // matrix values, skipping the column search in sumIntoLocalValues
+  const auto& jacOffsets = workset.wsJacOffsets;
+  const bool useOffsets = jacOffsets.size() != 0;
+  Tpetra_CrsMatrix::local_matrix_type::values_type JacT_values;
+  if (useOffsets) JacT_values = JacT->getLocalMatrix().values;
+  const bool diagonalOnly = workset.jacobian_diagonal_only;
+
   for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
     // Local Unks: Loop over nodes in element, Loop over equations per node
     for (unsigned int node_col=0, i=0; node_col<this->numNodes; node_col++){
@@ -516,7 +582,22 @@ evaluateFields(typename Traits::EvalData workset)
         if (loadResid)
           fT->sumIntoLocalValue(rowT, valptr.val());
         // Check derivative array is nonzero
-        if (valptr.hasFastAccess()) {
+        if (valptr.hasFastAccess() && diagonalOnly) {
+          // Only the derivative of the row with respect to its own unknown
+          const int row_unk = neq*node + this->offset + eq;
+          JacT->sumIntoLocalValues(
+            rowT, Teuchos::arrayView(&rowT, 1),
+            Teuchos::arrayView(&(valptr.fastAccessDx(row_unk)), 1));
+        }
+        else if (valptr.hasFastAccess() && useOffsets) {
+          const int row_unk = neq*node + this->offset + eq;
+          for (unsigned int lunk = 0; lunk < nunk; lunk++) {
+            const LO off = workset.is_adjoint ?
+              jacOffsets(cell,lunk,row_unk) : jacOffsets(cell,row_unk,lunk);
+            if (off >= 0) JacT_values(off) += valptr.fastAccessDx(lunk);
+          }
+        }
+        else if (valptr.hasFastAccess()) {
           if (workset.is_adjoint) {
             // Sum Jacobian transposed
             for (unsigned int lunk = 0; lunk < nunk; lunk++)
@@ -552,6 +633,7 @@ evaluateFields(typename Traits::EvalData workset)
     fT_kokkos = Kokkos::subview(fT_2d, Kokkos::ALL(), 0);
   }
   JacT_kokkos = workset.JacT->getLocalMatrix();
+  jacOffsets = workset.wsJacOffsets;
 
   if (this->tensorRank == 0) {
     // Get MDField views from std::vector
@@ -563,7 +645,11 @@ evaluateFields(typename Traits::EvalData workset)
       cudaCheckError();
     }
 
-    if (workset.is_adjoint) {
+    if (workset.jacobian_diagonal_only) {
+      Kokkos::parallel_for(PHAL_ScatterJacDiag_Policy(0,workset.numCells),*this);
+      cudaCheckError();
+    }
+    else if (workset.is_adjoint) {
       Kokkos::parallel_for(PHAL_ScatterJacRank0_Adjoint_Policy(0,workset.numCells),*this);  
       cudaCheckError();
     }
@@ -578,7 +664,11 @@ evaluateFields(typename Traits::EvalData workset)
       cudaCheckError();
     }
 
-    if (workset.is_adjoint) {
+    if (workset.jacobian_diagonal_only) {
+      Kokkos::parallel_for(PHAL_ScatterJacDiag_Policy(0,workset.numCells),*this);
+      cudaCheckError();
+    }
+    else if (workset.is_adjoint) {
       Kokkos::parallel_for(PHAL_ScatterJacRank1_Adjoint_Policy(0,workset.numCells),*this);
       cudaCheckError();
     }
@@ -595,7 +685,11 @@ evaluateFields(typename Traits::EvalData workset)
       cudaCheckError();
     }
 
-    if (workset.is_adjoint) {
+    if (workset.jacobian_diagonal_only) {
+      Kokkos::parallel_for(PHAL_ScatterJacDiag_Policy(0,workset.numCells),*this);
+      cudaCheckError();
+    }
+    else if (workset.is_adjoint) {
       Kokkos::parallel_for(PHAL_ScatterJacRank2_Adjoint_Policy(0,workset.numCells),*this);
     }
     else {
@@ -157,6 +157,30 @@ Albany::AbstractProblem::getGenericProblemParams(std::string listname) const
 
   validPL->set<bool>("Ignore Residual In Jacobian", false,
                      "Ignore residual calculations while computing the Jacobian (only generally appropriate for linear problems)");
+  validPL->set<int>("Workset Threads", 1,
+                  "Number of threads evaluating independent worksets concurrently (thread-safe Trilinos, Kokkos Serial, no ALBANY_KOKKOS_UNDER_DEVELOPMENT)");
+  validPL->set<bool>("Profile Evaluators", false,
+                  "Time every evaluator of the problem and estimate its field data traffic; reported per element block after the solve");
+  validPL->set<std::string>("Evaluator Profile Format", "Table",
+                  "Format of the evaluator profile: Table (CSV) or JSON");
+  validPL->set<bool>("Cache Basis Functions", false,
+                  "Keep the basis functions of each workset across evaluations until the mesh changes (not for coordinates updated by evaluators)");
+  validPL->set<bool>("Cache Reference Basis Functions Only", false,
+                  "With Cache Basis Functions, rebuild BF from the reference element instead of keeping it per cell");
+  validPL->set<bool>("Cache Residual", false,
+                  "Reuse the residual when the solver asks again at the last evaluated point; the Jacobian is always refilled (Tpetra model evaluator, not with distributed parameters or coupled applications)");
+  validPL->set<bool>("Matrix-Free Jacobian", false,
+                  "Apply the Jacobian through Tangent evaluations instead of assembling it (Tpetra model evaluator); the Stratimikos Preconditioner Type must be None, see Matrix-Free Preconditioner Type");
+  validPL->set<std::string>("Matrix-Free Preconditioner Type", "Jacobi",
+                  "Preconditioner of the matrix-free Jacobian: Jacobi (diagonal only, never assembles the Jacobian), None, or an Ifpack2 type (keeps an assembled Jacobian)");
+  validPL->set<int>("Matrix-Free Preconditioner Lag", 5,
+                  "Rebuild the matrix-free Jacobian preconditioner every this many Jacobian evaluations");
+  validPL->sublist("Matrix-Free Preconditioner Parameters", false,
+                  "Ifpack2 parameters of the matrix-free Jacobian preconditioner");
+  validPL->sublist("Preconditioner Reuse", false,
+                  "Build the Stratimikos preconditioner in the model evaluator and keep it across Jacobians (Tpetra model evaluator)");
+  validPL->set<int>("Workset Scratch Size", 0,
+                  "Bytes of scratch memory per workset thread for evaluator temporaries (0 to allocate them on the heap)");
   validPL->set<double>("Perturb Dirichlet", 0.0,
                      "Add this (small) perturbation to the diagonal to prevent Mass Matrices from being singular for Dirichlets)");
 
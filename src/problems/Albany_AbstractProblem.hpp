@@ -24,6 +24,7 @@
 
 #include "PHAL_AlbanyTraits.hpp"
 #include "PHAL_Dimension.hpp"
+#include "PHAL_ProfiledEvaluator.hpp"
 #include "PHAL_Workset.hpp"
 
 #include "Teuchos_VerboseObject.hpp"
@@ -269,8 +270,17 @@ struct ConstructEvaluatorsOp {
   template <typename T>
   void
   operator()(T x) const {
+    if (!PHAL::EvaluatorProfiler::instance().enabled()) {
+      tags->push_back(prob.template constructEvaluators<T>(
+          fm, meshSpecs, stateMgr, fmchoice, responseList));
+      return;
+    }
+    // "Profile Evaluators": build into a staging field manager and register
+    // every evaluator in fm wrapped for profiling
+    PHX::FieldManager<PHAL::AlbanyTraits> staging;
     tags->push_back(prob.template constructEvaluators<T>(
-        fm, meshSpecs, stateMgr, fmchoice, responseList));
+        staging, meshSpecs, stateMgr, fmchoice, responseList));
+    PHAL::registerProfiled<T>(staging, fm);
   }
 };
 }
@@ -22,6 +22,8 @@ void PerformanceContext::summarizeAll (
   timeMonitor_.summarize(comm, out);
   counterMonitor_.summarize(comm, out);
   variableMonitor_.summarize(comm, out);
+  for (auto& it : summaries_)
+    it.second(comm, out);
 }
 
 void PerformanceContext::summarizeAll (std::ostream& out) {
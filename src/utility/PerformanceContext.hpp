@@ -15,6 +15,9 @@
  *  \brief 
  */
 
+#include <functional>
+#include <map>
+
 #include "TimeMonitor.hpp"
 #include "CounterMonitor.hpp"
 #include "VariableMonitor.hpp"
@@ -40,6 +43,14 @@ public:
   VariableMonitor& variableMonitor () {
     return variableMonitor_;
   }
+
+  typedef std::function<void (Teuchos::Ptr<const Teuchos::Comm<int> >,
+                              std::ostream&)> Summary;
+
+  //! Add a report written by summarizeAll after the monitors, in name order
+  void addSummary (const string& name, const Summary& summary) {
+    summaries_[name] = summary;
+  }
   
 private:
   
@@ -48,6 +59,8 @@ private:
   TimeMonitor     timeMonitor_;
   CounterMonitor  counterMonitor_;
   VariableMonitor variableMonitor_;
+
+  std::map<string, Summary> summaries_;
 };
 }
 
@@ -9,7 +9,8 @@
 using namespace utility;
 
 StaticAllocator::StaticAllocator(std::size_t size)
-  : size_(size), buffer_(new unsigned char[size]), ptr_(buffer_)
+  : size_(size), buffer_(new unsigned char[size]), ptr_(buffer_),
+    high_water_(0)
 {
   
 }
@@ -19,9 +20,28 @@ StaticAllocator::~StaticAllocator()
   delete[] buffer_;
 }
 
+void *
+StaticAllocator::allocate(std::size_t size, std::size_t align)
+{
+  const std::size_t start = (used() + align - 1) / align * align;
+  if (start + size > size_)
+    return nullptr;
+
+  ptr_ = buffer_ + start + size;
+  high_water_ = std::max(high_water_, used());
+
+  return buffer_ + start;
+}
+
 void
 StaticAllocator::clear()
 {
   ptr_ = buffer_;
 }
 
+void
+StaticAllocator::rewind(std::size_t used)
+{
+  ptr_ = buffer_ + used;
+}
+
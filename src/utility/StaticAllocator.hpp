@@ -80,13 +80,24 @@ namespace utility
     template<typename T, typename... Args>
     StaticPointer<T> create(Args&&... args);
 
+    // Raw storage of size bytes aligned to align; nullptr if it does not fit
+    void *allocate(std::size_t size, std::size_t align);
+
     void clear();
+
+    // Bytes in use; rewind() releases everything allocated after a used()
+    std::size_t used() const { return ptr_ - buffer_; }
+    void rewind(std::size_t used);
+
+    // Largest number of bytes in use at any time
+    std::size_t highWater() const { return high_water_; }
     
   private:
     
     std::size_t    size_;
     unsigned char *buffer_;
     unsigned char *ptr_;
+    std::size_t    high_water_;
   };
 
   // Allocates memory on the stack but is fixed size at compile time
@@ -242,6 +253,7 @@ namespace utility
     
     unsigned char *ret = ptr_;
     ptr_ += sizeof(T);
+    high_water_ = std::max(high_water_, used());
     
     return new (ret) T(std::forward<Args>(args)...);
   }
@@ -0,0 +1,34 @@
+# 1. Run the serial and the parallel kernel of the Elastic Damage model
+
+foreach(INPUT inputElasticDamage2D.yaml inputParallelElasticDamage2D.yaml)
+  message("Running the command:")
+  message("${TEST_PROG} ${INPUT}")
+
+  EXECUTE_PROCESS(COMMAND ${TEST_PROG} ${INPUT}
+                  RESULT_VARIABLE HAD_ERROR)
+
+  if(HAD_ERROR)
+    message(FATAL_ERROR "Albany didn't run: test failed")
+  endif()
+endforeach()
+
+# 2. Compare the two exodus outputs with exodiff
+
+if (NOT SEACAS_EXODIFF)
+  message(FATAL_ERROR "Cannot find exodiff")
+endif()
+
+SET(EXODIFF_TEST ${SEACAS_EXODIFF} -f ${DATA_DIR}/ElasticDamage.exodiff_commands
+    quad2d_elastic_damage_tpetra.e quad2d_parallel_elastic_damage_tpetra.e)
+
+message("Running the command:")
+message("${EXODIFF_TEST}")
+
+EXECUTE_PROCESS(
+    COMMAND ${EXODIFF_TEST}
+    OUTPUT_FILE exodiff.out
+    RESULT_VARIABLE HAD_ERROR)
+
+if(HAD_ERROR)
+  message(FATAL_ERROR "Test failed")
+endif()